@@ -0,0 +1,416 @@
+// Copyright (C) 2023 Wouter Deconinck
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "AdjacencyMatrixExpression.h"
+
+#include <fmt/core.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace eicrecon {
+
+/** Recursive descent compiler from the expression string to the postfix program.
+ *
+ * Every parse step returns a description of the code it emitted. When all
+ * operands of an operation are constants, the constants are popped from the
+ * program again and the folded result is emitted instead.
+ */
+class AdjacencyMatrixExpression::Parser {
+
+public:
+  Parser(AdjacencyMatrixExpression& expr, const std::string& text, const dd4hep::IDDescriptor& id_spec)
+  : m_expr(expr), m_text(text), m_idSpec(id_spec) {
+  }
+
+  void compile() {
+    parseOr();
+    skipSpace();
+    if (m_pos != m_text.size()) {
+      fail(fmt::format("unexpected '{}'", m_text.substr(m_pos)));
+    }
+    if (m_maxDepth > kMaxStackDepth) {
+      fail("expression is too deeply nested");
+    }
+  }
+
+private:
+  struct Operand {
+    bool constant{false};
+    bool integer{false};
+    double value{0.};
+  };
+
+  static constexpr std::size_t kMaxOperands = 2;
+
+  AdjacencyMatrixExpression& m_expr;
+  const std::string& m_text;
+  const dd4hep::IDDescriptor& m_idSpec;
+  std::size_t m_pos{0};
+  std::size_t m_depth{0};
+  std::size_t m_maxDepth{0};
+  std::map<std::string, std::size_t> m_fieldIndex;
+
+  [[noreturn]] void fail(const std::string& what) const {
+    throw std::runtime_error(fmt::format("Cannot compile adjacencyMatrix \"{}\" at position {}: {}", m_text, m_pos, what));
+  }
+
+  void skipSpace() {
+    while (m_pos < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_pos]))) {
+      ++m_pos;
+    }
+  }
+
+  bool accept(const char* token) {
+    skipSpace();
+    const std::size_t len = std::char_traits<char>::length(token);
+    if (m_text.compare(m_pos, len, token) != 0) {
+      return false;
+    }
+    // do not split "<=" into "<" and "=", or "&&" into "&" and "&"
+    if (len == 1 && m_pos + 1 < m_text.size()) {
+      const char next = m_text[m_pos + 1];
+      if ((std::string("<>=!").find(token[0]) != std::string::npos && next == '=')
+          || (token[0] == '&' && next == '&') || (token[0] == '|' && next == '|')) {
+        return false;
+      }
+    }
+    m_pos += len;
+    return true;
+  }
+
+  void expect(const char* token) {
+    if (!accept(token)) {
+      fail(fmt::format("expected '{}'", token));
+    }
+  }
+
+  void emit(Op op, double value = 0., std::size_t index = 0) {
+    m_expr.m_program.push_back({op, value, index});
+    switch (arity(op)) {
+      case 0: ++m_depth; break;
+      case 2: --m_depth; break;
+      default: break;
+    }
+    m_maxDepth = std::max(m_maxDepth, m_depth);
+  }
+
+  Operand constant(double value, bool integer) {
+    emit(Op::Const, value);
+    return {true, integer, value};
+  }
+
+  static std::size_t arity(Op op) {
+    switch (op) {
+      case Op::Const: case Op::Field1: case Op::Field2:
+        return 0;
+      case Op::Neg: case Op::Not:
+      case Op::Abs: case Op::Floor: case Op::Ceil: case Op::Round: case Op::Sqrt:
+        return 1;
+      default:
+        return 2;
+    }
+  }
+
+  // emit op applied to the operands just emitted, folding constants
+  Operand apply(Op op, const std::array<Operand, kMaxOperands>& args) {
+    const std::size_t n = arity(op);
+    for (std::size_t i = 0; i < n; ++i) {
+      if (!args[i].constant) {
+        emit(op);
+        return {};
+      }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      m_expr.m_program.pop_back();
+      --m_depth;
+    }
+    bool integer = args[0].integer && (n < 2 || args[1].integer);
+    const double a = args[0].value;
+    const double b = args[1].value;
+    if (integer) {
+      const long long ia = static_cast<long long>(a);
+      const long long ib = static_cast<long long>(b);
+      switch (op) {
+        case Op::Neg: return constant(-ia, true);
+        case Op::Add: return constant(ia + ib, true);
+        case Op::Sub: return constant(ia - ib, true);
+        case Op::Mul: return constant(ia * ib, true);
+        case Op::Div:
+          if (ib == 0) {
+            fail("integer division by zero");
+          }
+          return constant(ia / ib, true);
+        case Op::Abs: return constant(std::llabs(ia), true);
+        case Op::Min: return constant(std::min(ia, ib), true);
+        case Op::Max: return constant(std::max(ia, ib), true);
+        default: break;
+      }
+    }
+    switch (op) {
+      case Op::Not: case Op::Lt: case Op::Le: case Op::Gt: case Op::Ge: case Op::Eq: case Op::Ne: case Op::And: case Op::Or:
+        integer = true;
+        break;
+      default:
+        integer = false;
+        break;
+    }
+    return constant(evaluate(op, a, b), integer);
+  }
+
+  Operand parseBinary(Operand (Parser::*parseOperand)(), const std::vector<std::pair<const char*, Op>>& ops) {
+    Operand lhs = (this->*parseOperand)();
+    while (true) {
+      bool found = false;
+      for (const auto& [token, op] : ops) {
+        if (accept(token)) {
+          Operand rhs = (this->*parseOperand)();
+          lhs = apply(op, {lhs, rhs});
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        return lhs;
+      }
+    }
+  }
+
+  Operand parseOr() {
+    return parseBinary(&Parser::parseAnd, {{"||", Op::Or}});
+  }
+
+  Operand parseAnd() {
+    return parseBinary(&Parser::parseEquality, {{"&&", Op::And}});
+  }
+
+  Operand parseEquality() {
+    return parseBinary(&Parser::parseRelational, {{"==", Op::Eq}, {"!=", Op::Ne}});
+  }
+
+  Operand parseRelational() {
+    return parseBinary(&Parser::parseAdditive, {{"<=", Op::Le}, {">=", Op::Ge}, {"<", Op::Lt}, {">", Op::Gt}});
+  }
+
+  Operand parseAdditive() {
+    return parseBinary(&Parser::parseMultiplicative, {{"+", Op::Add}, {"-", Op::Sub}});
+  }
+
+  Operand parseMultiplicative() {
+    Operand lhs = parseUnary();
+    while (true) {
+      if (accept("*")) {
+        lhs = apply(Op::Mul, {lhs, parseUnary()});
+      } else if (accept("/")) {
+        lhs = apply(Op::Div, {lhs, parseUnary()});
+      } else if (accept("%")) {
+        // only valid on integers in C++, so it has to be folded away
+        Operand rhs = parseUnary();
+        if (!(lhs.integer && lhs.constant && rhs.integer && rhs.constant)) {
+          fail("operator % requires integer literal operands, use fmod");
+        }
+        if (static_cast<long long>(rhs.value) == 0) {
+          fail("integer division by zero");
+        }
+        m_expr.m_program.pop_back();
+        m_expr.m_program.pop_back();
+        m_depth -= 2;
+        lhs = constant(static_cast<long long>(lhs.value) % static_cast<long long>(rhs.value), true);
+      } else {
+        return lhs;
+      }
+    }
+  }
+
+  Operand parseUnary() {
+    if (accept("-")) {
+      return apply(Op::Neg, {parseUnary()});
+    }
+    if (accept("+")) {
+      return parseUnary();
+    }
+    if (accept("!")) {
+      return apply(Op::Not, {parseUnary()});
+    }
+    return parsePrimary();
+  }
+
+  Operand parsePrimary() {
+    skipSpace();
+    if (m_pos >= m_text.size()) {
+      fail("unexpected end of expression");
+    }
+
+    if (accept("(")) {
+      Operand result = parseOr();
+      expect(")");
+      return result;
+    }
+
+    const char c = m_text[m_pos];
+    if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+      const char* begin = m_text.c_str() + m_pos;
+      char* end = nullptr;
+      const double value = std::strtod(begin, &end);
+      if (end == begin) {
+        fail("invalid number");
+      }
+      const std::string literal(begin, static_cast<std::size_t>(end - begin));
+      m_pos += literal.size();
+      return constant(value, literal.find_first_of(".eE") == std::string::npos);
+    }
+
+    if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+      std::size_t end = m_pos;
+      while (end < m_text.size()
+             && (std::isalnum(static_cast<unsigned char>(m_text[end])) || m_text[end] == '_' || m_text[end] == ':')) {
+        ++end;
+      }
+      std::string name = m_text.substr(m_pos, end - m_pos);
+      m_pos = end;
+      if (name.rfind("std::", 0) == 0) {
+        name = name.substr(5);
+      }
+      if (accept("(")) {
+        return parseCall(name);
+      }
+      if (name == "true" || name == "false") {
+        return constant(name == "true" ? 1 : 0, true);
+      }
+      return parseField(name);
+    }
+
+    fail(fmt::format("unexpected '{}'", c));
+  }
+
+  Operand parseCall(const std::string& name) {
+    static const std::map<std::string, Op> functions{
+      {"abs", Op::Abs}, {"fabs", Op::Abs}, {"floor", Op::Floor}, {"ceil", Op::Ceil},
+      {"round", Op::Round}, {"sqrt", Op::Sqrt}, {"fmod", Op::Fmod}, {"pow", Op::Pow},
+      {"min", Op::Min}, {"max", Op::Max},
+    };
+    auto it = functions.find(name);
+    if (it == functions.end()) {
+      fail(fmt::format("unknown function {}", name));
+    }
+    const Op op = it->second;
+    std::array<Operand, kMaxOperands> args;
+    for (std::size_t i = 0; i < arity(op); ++i) {
+      if (i > 0) {
+        expect(",");
+      }
+      args[i] = parseOr();
+    }
+    expect(")");
+    if (name == "fabs") {
+      args[0].integer = false;
+    }
+    return apply(op, args);
+  }
+
+  Operand parseField(const std::string& name) {
+    const std::size_t len = name.size();
+    if (len < 3 || name[len - 2] != '_' || (name[len - 1] != '1' && name[len - 1] != '2')) {
+      fail(fmt::format("unknown identifier {}, expected a readout field with suffix _1 or _2", name));
+    }
+    const std::string field_name = name.substr(0, len - 2);
+
+    auto it = m_fieldIndex.find(field_name);
+    if (it == m_fieldIndex.end()) {
+      const dd4hep::IDDescriptor::Field* field = nullptr;
+      for (const auto& [id_name, id_field] : m_idSpec.fields()) {
+        if (id_name == field_name) {
+          field = id_field;
+        }
+      }
+      if (field == nullptr) {
+        fail(fmt::format("readout has no field {}", field_name));
+      }
+      if (m_expr.m_fields.size() >= kMaxFields) {
+        fail("too many fields");
+      }
+      it = m_fieldIndex.emplace(field_name, m_expr.m_fields.size()).first;
+      m_expr.m_fields.push_back(field);
+    }
+
+    emit(name[len - 1] == '1' ? Op::Field1 : Op::Field2, 0., it->second);
+    return {};
+  }
+
+public:
+  static double evaluate(Op op, double a, double b) {
+    switch (op) {
+      case Op::Neg: return -a;
+      case Op::Not: return a == 0.;
+      case Op::Add: return a + b;
+      case Op::Sub: return a - b;
+      case Op::Mul: return a * b;
+      case Op::Div: return a / b;
+      case Op::Lt: return a < b;
+      case Op::Le: return a <= b;
+      case Op::Gt: return a > b;
+      case Op::Ge: return a >= b;
+      case Op::Eq: return a == b;
+      case Op::Ne: return a != b;
+      case Op::And: return (a != 0.) && (b != 0.);
+      case Op::Or: return (a != 0.) || (b != 0.);
+      case Op::Abs: return std::abs(a);
+      case Op::Floor: return std::floor(a);
+      case Op::Ceil: return std::ceil(a);
+      case Op::Round: return std::round(a);
+      case Op::Sqrt: return std::sqrt(a);
+      case Op::Fmod: return std::fmod(a, b);
+      case Op::Pow: return std::pow(a, b);
+      case Op::Min: return std::min(a, b);
+      case Op::Max: return std::max(a, b);
+      default: return 0.;
+    }
+  }
+};
+
+AdjacencyMatrixExpression::AdjacencyMatrixExpression(const std::string& expression, const dd4hep::IDDescriptor& id_spec) {
+  Parser(*this, expression, id_spec).compile();
+}
+
+bool AdjacencyMatrixExpression::operator()(std::uint64_t cellID1, std::uint64_t cellID2) const {
+  // decode only the referenced fields, once per cell
+  std::array<double, 2 * kMaxFields> values;
+  for (std::size_t i = 0; i < m_fields.size(); ++i) {
+    values[2 * i] = m_fields[i]->value(cellID1);
+    values[2 * i + 1] = m_fields[i]->value(cellID2);
+  }
+
+  std::array<double, kMaxStackDepth> stack;
+  std::size_t top = 0;
+  for (const auto& ins : m_program) {
+    switch (ins.op) {
+      case Op::Const:
+        stack[top++] = ins.value;
+        break;
+      case Op::Field1:
+        stack[top++] = values[2 * ins.index];
+        break;
+      case Op::Field2:
+        stack[top++] = values[2 * ins.index + 1];
+        break;
+      case Op::Neg: case Op::Not:
+      case Op::Abs: case Op::Floor: case Op::Ceil: case Op::Round: case Op::Sqrt:
+        stack[top - 1] = Parser::evaluate(ins.op, stack[top - 1], 0.);
+        break;
+      default:
+        --top;
+        stack[top - 1] = Parser::evaluate(ins.op, stack[top - 1], stack[top]);
+        break;
+    }
+  }
+  return stack[0] != 0.;
+}
+
+} // namespace eicrecon
@@ -0,0 +1,64 @@
+// Copyright (C) 2023 Wouter Deconinck
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include <DD4hep/IDDescriptor.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eicrecon {
+
+  /** Compiled adjacency matrix expression.
+   *
+   * The expression is written in terms of the readout fields of two cells,
+   * suffixed with _1 and _2, e.g. "abs(x_1 - x_2) + abs(y_1 - y_2) == 1".
+   * It is compiled once into a flat postfix program over the fields that are
+   * actually referenced, so that testing a pair of cells needs neither the ROOT
+   * interpreter nor any memory allocation.
+   *
+   * Supported are numeric literals, the C++ arithmetic, comparison and logical
+   * operators, and the functions abs, fabs, floor, ceil, round, sqrt, fmod,
+   * pow, min and max. Subexpressions of integer literals are folded with C++
+   * integer semantics, all other arithmetic is done in double precision.
+   */
+  class AdjacencyMatrixExpression {
+
+  public:
+    /// Throws std::runtime_error if the expression cannot be compiled
+    AdjacencyMatrixExpression(const std::string& expression, const dd4hep::IDDescriptor& id_spec);
+
+    bool operator()(std::uint64_t cellID1, std::uint64_t cellID2) const;
+
+    /// Number of readout fields referenced by the expression
+    std::size_t fieldCount() const { return m_fields.size(); }
+
+  private:
+    class Parser;
+
+    enum class Op {
+      Const, Field1, Field2,
+      Neg, Not,
+      Add, Sub, Mul, Div,
+      Lt, Le, Gt, Ge, Eq, Ne, And, Or,
+      Abs, Floor, Ceil, Round, Sqrt,
+      Fmod, Pow, Min, Max,
+    };
+
+    struct Instruction {
+      Op op;
+      double value{0.};
+      std::size_t index{0};
+    };
+
+    // bounds for the evaluation scratch space, which lives on the stack
+    static constexpr std::size_t kMaxFields = 64;
+    static constexpr std::size_t kMaxStackDepth = 64;
+
+    std::vector<const dd4hep::IDDescriptor::Field*> m_fields;
+    std::vector<Instruction> m_program;
+  };
+
+} // namespace eicrecon
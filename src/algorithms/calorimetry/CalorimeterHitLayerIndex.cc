@@ -0,0 +1,114 @@
+// Copyright (C) 2023 Wouter Deconinck
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "CalorimeterHitLayerIndex.h"
+
+#include <cmath>
+
+namespace eicrecon {
+
+void CalorimeterHitLayerIndex::init(std::array<double, 2> localDistXY, std::array<double, 2> layerDistEtaPhi, int neighbourLayersRange, double sectorDist) {
+  m_localDistXY = localDistXY;
+  m_layerDistEtaPhi = layerDistEtaPhi;
+  m_neighbourLayersRange = neighbourLayersRange;
+  m_sectorDist = sectorDist;
+}
+
+void CalorimeterHitLayerIndex::build(const edm4eic::CalorimeterHitCollection& hits, double minHitEdep) {
+  const std::size_t n_hits = hits.size();
+  m_hits.resize(n_hits);
+  m_localKeys.resize(n_hits);
+  m_angularKeys.resize(n_hits);
+  m_globalKeys.resize(n_hits);
+  m_localCells.clear();
+  m_angularCells.clear();
+  m_globalCells.clear();
+  m_multiSector = false;
+
+  // per-hit quantities, and their extents to size the bins
+  std::array<double, 2> max_abs_local{0., 0.};
+  std::array<double, 2> max_abs_angular{0., 0.};
+  double max_abs_global = 0.;
+  auto update = [](double& max_abs, double x) {
+    if (std::isfinite(x)) {
+      max_abs = std::max(max_abs, std::abs(x));
+    }
+  };
+  for (std::size_t idx = 0; idx < n_hits; ++idx) {
+    const auto& hit = hits[idx];
+    HitInfo& info = m_hits[idx];
+    info.sector = hit.getSector();
+    info.layer = hit.getLayer();
+    info.local = hit.getLocal();
+    info.position = hit.getPosition();
+    info.eta = edm4hep::utils::eta(info.position);
+    info.phi = edm4hep::utils::angleAzimuthal(info.position);
+
+    if (idx == 0) {
+      m_minLayer = m_maxLayer = info.layer;
+    }
+    m_minLayer = std::min(m_minLayer, info.layer);
+    m_maxLayer = std::max(m_maxLayer, info.layer);
+    if (info.sector != m_hits[0].sector) {
+      m_multiSector = true;
+    }
+
+    update(max_abs_local[0], info.local.x);
+    update(max_abs_local[1], info.local.y);
+    update(max_abs_angular[0], info.eta);
+    update(max_abs_angular[1], info.phi);
+    update(max_abs_global, info.position.x);
+    update(max_abs_global, info.position.y);
+    update(max_abs_global, info.position.z);
+  }
+
+  const std::array<double, 2> local_width{
+    CellGrid<4>::padded_width(m_localDistXY[0], max_abs_local[0]),
+    CellGrid<4>::padded_width(m_localDistXY[1], max_abs_local[1])
+  };
+  const std::array<double, 2> angular_width{
+    CellGrid<4>::padded_width(m_layerDistEtaPhi[0], max_abs_angular[0]),
+    CellGrid<4>::padded_width(m_layerDistEtaPhi[1], max_abs_angular[1])
+  };
+  const double global_width = CellGrid<3>::padded_width(m_sectorDist, max_abs_global);
+
+  for (std::size_t idx = 0; idx < n_hits; ++idx) {
+    const HitInfo& info = m_hits[idx];
+    m_localKeys[idx] = {
+      info.sector,
+      info.layer,
+      CellGrid<4>::bin(info.local.x, local_width[0]),
+      CellGrid<4>::bin(info.local.y, local_width[1])
+    };
+    m_angularKeys[idx] = {
+      info.sector,
+      info.layer,
+      CellGrid<4>::bin(info.eta, angular_width[0]),
+      CellGrid<4>::bin(info.phi, angular_width[1])
+    };
+    if (m_multiSector) {
+      m_globalKeys[idx] = {
+        CellGrid<3>::bin(info.position.x, global_width),
+        CellGrid<3>::bin(info.position.y, global_width),
+        CellGrid<3>::bin(info.position.z, global_width)
+      };
+    }
+
+    // not a qualified hit to participate in clustering, never a candidate
+    if (hits[idx].getEnergy() < minHitEdep) {
+      continue;
+    }
+    m_localCells.insert(m_localKeys[idx], idx);
+    if (m_neighbourLayersRange > 0) {
+      m_angularCells.insert(m_angularKeys[idx], idx);
+    }
+    if (m_multiSector) {
+      m_globalCells.insert(m_globalKeys[idx], idx);
+    }
+  }
+  m_localCells.sort();
+  m_angularCells.sort();
+  m_globalCells.sort();
+}
+
+} // namespace eicrecon
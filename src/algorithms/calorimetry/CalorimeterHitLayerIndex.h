@@ -0,0 +1,120 @@
+// Copyright (C) 2023 Wouter Deconinck
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include <edm4eic/CalorimeterHitCollection.h>
+#include <edm4hep/Vector3f.h>
+#include <edm4hep/utils/vector_utils.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "CellGrid.h"
+
+namespace eicrecon {
+
+  /** Index of the hits of one event by (sector, layer), for imaging calorimeters.
+   *
+   * The hit quantities used in neighbour checks, including eta and phi, are
+   * computed once per hit. Within a sector and layer, hits are binned in local
+   * (x, y), and in global (eta, phi) for matching against nearby layers.
+   * Hits of all sectors are binned in global position for matching across
+   * sectors. The candidates returned for a hit are a superset of its
+   * neighbours: the caller still applies the exact neighbour predicate.
+   */
+  class CalorimeterHitLayerIndex {
+
+  public:
+    using eta_type = decltype(edm4hep::utils::eta(std::declval<edm4hep::Vector3f>()));
+    using phi_type = decltype(edm4hep::utils::angleAzimuthal(std::declval<edm4hep::Vector3f>()));
+
+    struct HitInfo {
+      std::int32_t sector;
+      std::int32_t layer;
+      edm4hep::Vector3f local;
+      edm4hep::Vector3f position;
+      eta_type eta;
+      phi_type phi;
+    };
+
+    /// Neighbour distances as used by the clustering, in mm and rad
+    void init(std::array<double, 2> localDistXY, std::array<double, 2> layerDistEtaPhi, int neighbourLayersRange, double sectorDist);
+
+    /// Index all hits with energy of at least minHitEdep
+    void build(const edm4eic::CalorimeterHitCollection& hits, double minHitEdep);
+
+    const HitInfo& operator[](std::size_t idx) const { return m_hits[idx]; }
+
+    /// Call visit(idx2) for every indexed hit that may be a neighbour of hit idx
+    template<typename Visitor>
+    void for_each_candidate(std::size_t idx, Visitor&& visit) const {
+      const HitInfo& hit = m_hits[idx];
+
+      // same layer, local coordinates
+      const auto& lkey = m_localKeys[idx];
+      for (std::int64_t dx = -1; dx <= 1; ++dx) {
+        for (std::int64_t dy = -1; dy <= 1; ++dy) {
+          m_localCells.for_each_in_cell({lkey[0], lkey[1], lkey[2] + dx, lkey[3] + dy}, visit);
+        }
+      }
+
+      // nearby layers, global angles
+      const auto& akey = m_angularKeys[idx];
+      const std::int64_t first_layer = std::max<std::int64_t>(hit.layer - m_neighbourLayersRange, m_minLayer);
+      const std::int64_t last_layer = std::min<std::int64_t>(hit.layer + m_neighbourLayersRange, m_maxLayer);
+      for (std::int64_t layer = first_layer; layer <= last_layer; ++layer) {
+        if (layer == hit.layer) {
+          continue;
+        }
+        for (std::int64_t deta = -1; deta <= 1; ++deta) {
+          for (std::int64_t dphi = -1; dphi <= 1; ++dphi) {
+            m_angularCells.for_each_in_cell({akey[0], layer, akey[2] + deta, akey[3] + dphi}, visit);
+          }
+        }
+      }
+
+      // other sectors, global position
+      if (!m_multiSector) {
+        return;
+      }
+      const auto& gkey = m_globalKeys[idx];
+      for (std::int64_t dx = -1; dx <= 1; ++dx) {
+        for (std::int64_t dy = -1; dy <= 1; ++dy) {
+          for (std::int64_t dz = -1; dz <= 1; ++dz) {
+            m_globalCells.for_each_in_cell({gkey[0] + dx, gkey[1] + dy, gkey[2] + dz}, [&](std::size_t idx2) {
+              if (m_hits[idx2].sector != hit.sector) {
+                visit(idx2);
+              }
+            });
+          }
+        }
+      }
+    }
+
+  private:
+    std::array<double, 2> m_localDistXY{0., 0.};
+    std::array<double, 2> m_layerDistEtaPhi{0., 0.};
+    int m_neighbourLayersRange{0};
+    double m_sectorDist{0.};
+
+    std::vector<HitInfo> m_hits;
+    std::int32_t m_minLayer{0};
+    std::int32_t m_maxLayer{0};
+    bool m_multiSector{false};
+
+    // per-hit cells, indexed by hit index
+    std::vector<CellGrid<4>::Key> m_localKeys;
+    std::vector<CellGrid<4>::Key> m_angularKeys;
+    std::vector<CellGrid<3>::Key> m_globalKeys;
+
+    // indexed hits, by (sector, layer, x, y), by (sector, layer, eta, phi) and by global position
+    CellGrid<4> m_localCells;
+    CellGrid<4> m_angularCells;
+    CellGrid<3> m_globalCells;
+  };
+
+} // namespace eicrecon
@@ -0,0 +1,135 @@
+// Copyright (C) 2023 Wouter Deconinck
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "CalorimeterHitNeighbourIndex.h"
+
+#include <edm4hep/Vector3f.h>
+#include <edm4hep/utils/vector_utils.h>
+#include <cmath>
+#include <map>
+
+namespace eicrecon {
+
+using Grid = CellGrid<3>;
+
+std::optional<CalorimeterHitNeighbourIndex::Metric> CalorimeterHitNeighbourIndex::metricFromName(const std::string& name) {
+  static const std::map<std::string, Metric> metrics{
+    {"localDistXY", Metric::localDistXY},
+    {"localDistXZ", Metric::localDistXZ},
+    {"localDistYZ", Metric::localDistYZ},
+    {"dimScaledLocalDistXY", Metric::dimScaledLocalDistXY},
+    {"globalDistRPhi", Metric::globalDistRPhi},
+    {"globalDistEtaPhi", Metric::globalDistEtaPhi},
+  };
+  auto it = metrics.find(name);
+  if (it == metrics.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+CalorimeterHitNeighbourIndex::CalorimeterHitNeighbourIndex(Metric metric, std::array<double, 2> neighbourDist, double sectorDist)
+: m_metric(metric), m_neighbourDist(neighbourDist), m_sectorDist(sectorDist) {
+}
+
+std::array<double, 2> CalorimeterHitNeighbourIndex::coordinates(const edm4eic::CalorimeterHit& hit) const {
+  switch (m_metric) {
+    case Metric::localDistXY:
+    case Metric::dimScaledLocalDistXY:
+      return {hit.getLocal().x, hit.getLocal().y};
+    case Metric::localDistXZ:
+      return {hit.getLocal().x, hit.getLocal().z};
+    case Metric::localDistYZ:
+      return {hit.getLocal().y, hit.getLocal().z};
+    case Metric::globalDistRPhi:
+      return {edm4hep::utils::magnitude(hit.getPosition()), edm4hep::utils::angleAzimuthal(hit.getPosition())};
+    case Metric::globalDistEtaPhi:
+      return {edm4hep::utils::eta(hit.getPosition()), edm4hep::utils::angleAzimuthal(hit.getPosition())};
+  }
+  return {0., 0.};
+}
+
+void CalorimeterHitNeighbourIndex::build(const edm4eic::CalorimeterHitCollection& hits, double minHitEdep) {
+  const std::size_t n_hits = hits.size();
+  m_localKeys.resize(n_hits);
+  m_globalKeys.resize(n_hits);
+  m_sectors.resize(n_hits);
+  m_coords.resize(n_hits);
+  m_localCells.clear();
+  m_globalCells.clear();
+  m_multiSector = false;
+
+  // coordinate extents, needed to size the bins
+  std::array<double, 2> max_abs{0., 0.};
+  std::array<double, 2> max_dim{0., 0.};
+  double max_abs_global = 0.;
+  for (std::size_t idx = 0; idx < n_hits; ++idx) {
+    const auto& hit = hits[idx];
+    m_coords[idx] = coordinates(hit);
+    m_sectors[idx] = hit.getSector();
+    if (m_sectors[idx] != m_sectors[0]) {
+      m_multiSector = true;
+    }
+    for (std::size_t i = 0; i < 2; ++i) {
+      if (std::isfinite(m_coords[idx][i])) {
+        max_abs[i] = std::max(max_abs[i], std::abs(m_coords[idx][i]));
+      }
+    }
+    if (m_metric == Metric::dimScaledLocalDistXY) {
+      max_dim[0] = std::max(max_dim[0], static_cast<double>(hit.getDimension().x));
+      max_dim[1] = std::max(max_dim[1], static_cast<double>(hit.getDimension().y));
+    }
+    const auto& pos = hit.getPosition();
+    for (double x : {pos.x, pos.y, pos.z}) {
+      max_abs_global = std::max(max_abs_global, std::abs(x));
+    }
+  }
+
+  // bin widths
+  std::array<double, 2> reach = m_neighbourDist;
+  if (m_metric == Metric::dimScaledLocalDistXY) {
+    // |2 dx / (dim1 + dim2)| <= dist implies |dx| <= dist * max(dim)
+    reach[0] *= max_dim[0];
+    reach[1] *= max_dim[1];
+  }
+  std::array<double, 2> width{Grid::padded_width(reach[0], max_abs[0]), Grid::padded_width(reach[1], max_abs[1])};
+  double phi_offset = 0.;
+  m_nPhiBins = 0;
+  if (m_metric == Metric::globalDistRPhi || m_metric == Metric::globalDistEtaPhi) {
+    // phi differences wrap around, so use an integer number of bins over 2 pi
+    const double n_bins = std::floor(2 * M_PI / width[1]);
+    m_nPhiBins = (std::isfinite(n_bins) && n_bins >= 3) ? static_cast<std::int64_t>(std::min(n_bins, 1e12)) : 1;
+    width[1] = 2 * M_PI / m_nPhiBins;
+    phi_offset = M_PI;
+  }
+  const double global_width = Grid::padded_width(m_sectorDist, max_abs_global);
+
+  for (std::size_t idx = 0; idx < n_hits; ++idx) {
+    m_localKeys[idx] = {
+      m_sectors[idx],
+      Grid::bin(m_coords[idx][0], width[0]),
+      wrap_b(Grid::bin(m_coords[idx][1] + phi_offset, width[1]))
+    };
+    if (m_multiSector) {
+      const auto& pos = hits[idx].getPosition();
+      m_globalKeys[idx] = {
+        Grid::bin(pos.x, global_width),
+        Grid::bin(pos.y, global_width),
+        Grid::bin(pos.z, global_width)
+      };
+    }
+
+    // not a qualified hit to participate in clustering, never a candidate
+    if (hits[idx].getEnergy() < minHitEdep) {
+      continue;
+    }
+    m_localCells.insert(m_localKeys[idx], idx);
+    if (m_multiSector) {
+      m_globalCells.insert(m_globalKeys[idx], idx);
+    }
+  }
+  m_localCells.sort();
+  m_globalCells.sort();
+}
+
+} // namespace eicrecon
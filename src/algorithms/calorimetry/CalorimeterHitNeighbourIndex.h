@@ -0,0 +1,110 @@
+// Copyright (C) 2023 Wouter Deconinck
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include <edm4eic/CalorimeterHitCollection.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "CellGrid.h"
+
+namespace eicrecon {
+
+  /** Spatial index over the hits of one event, used to limit neighbour searches.
+   *
+   * Hits in the same sector are binned on a 2D grid in the coordinates of the
+   * clustering distance metric, with bins at least as wide as the neighbour
+   * distance. Hits are additionally binned on a 3D grid in global position with
+   * bins of at least `sectorDist`, which covers neighbours across sectors.
+   *
+   * The candidates returned for a hit are a superset of its neighbours: the
+   * caller still applies the exact neighbour predicate to every candidate.
+   */
+  class CalorimeterHitNeighbourIndex {
+
+  public:
+    enum class Metric {
+      localDistXY,
+      localDistXZ,
+      localDistYZ,
+      dimScaledLocalDistXY,
+      globalDistRPhi,
+      globalDistEtaPhi,
+    };
+
+    static std::optional<Metric> metricFromName(const std::string& name);
+
+    CalorimeterHitNeighbourIndex(Metric metric, std::array<double, 2> neighbourDist, double sectorDist);
+
+    /// Index all hits with energy of at least minHitEdep
+    void build(const edm4eic::CalorimeterHitCollection& hits, double minHitEdep);
+
+    /// Call visit(idx2) for every indexed hit that may be a neighbour of hit idx
+    template<typename Visitor>
+    void for_each_candidate(std::size_t idx, Visitor&& visit) const {
+      const Key& key = m_localKeys[idx];
+      const std::int64_t b_range = (m_nPhiBins == 1) ? 0 : 1;
+      for (std::int64_t da = -1; da <= 1; ++da) {
+        for (std::int64_t db = -b_range; db <= b_range; ++db) {
+          m_localCells.for_each_in_cell({key[0], key[1] + da, wrap_b(key[2] + db)}, visit);
+        }
+      }
+
+      // neighbours in other sectors
+      if (!m_multiSector) {
+        return;
+      }
+      const Key& gkey = m_globalKeys[idx];
+      const std::int32_t sector = m_sectors[idx];
+      for (std::int64_t dx = -1; dx <= 1; ++dx) {
+        for (std::int64_t dy = -1; dy <= 1; ++dy) {
+          for (std::int64_t dz = -1; dz <= 1; ++dz) {
+            m_globalCells.for_each_in_cell({gkey[0] + dx, gkey[1] + dy, gkey[2] + dz}, [&](std::size_t idx2) {
+              if (m_sectors[idx2] != sector) {
+                visit(idx2);
+              }
+            });
+          }
+        }
+      }
+    }
+
+  private:
+    using Key = CellGrid<3>::Key;
+
+    std::int64_t wrap_b(std::int64_t b) const {
+      if (m_nPhiBins == 0) {
+        return b;
+      }
+      return ((b % m_nPhiBins) + m_nPhiBins) % m_nPhiBins;
+    }
+
+    std::array<double, 2> coordinates(const edm4eic::CalorimeterHit& hit) const;
+
+    Metric m_metric;
+    std::array<double, 2> m_neighbourDist;
+    double m_sectorDist;
+
+    // number of bins in phi for periodic metrics, 0 otherwise
+    std::int64_t m_nPhiBins{0};
+    bool m_multiSector{false};
+
+    // per-hit bins, indexed by hit index
+    std::vector<Key> m_localKeys;
+    std::vector<Key> m_globalKeys;
+    std::vector<std::int32_t> m_sectors;
+
+    // indexed hits, by (sector, bin, bin) and by global position
+    CellGrid<3> m_localCells;
+    CellGrid<3> m_globalCells;
+
+    // scratch space reused between events
+    std::vector<std::array<double, 2>> m_coords;
+  };
+
+} // namespace eicrecon
@@ -21,10 +21,8 @@
 #include <Math/GenVector/DisplacementVector3D.h>
 #include <fmt/core.h>
 #include <fmt/format.h>
-#include <algorithm>
 #include <cctype>
 #include <exception>
-#include <functional>
 #include <map>
 #include <ostream>
 #include <stdexcept>
@@ -38,9 +36,9 @@ using namespace dd4hep;
 
 namespace eicrecon {
 
-void CalorimeterHitReco::init(const dd4hep::Detector* detector, const dd4hep::rec::CellIDPositionConverter* converter, std::shared_ptr<spdlog::logger>& logger) {
+void CalorimeterHitReco::init(const dd4hep::Detector* detector, CellIDGeometryCache* cache, std::shared_ptr<spdlog::logger>& logger) {
     m_detector = detector;
-    m_converter = converter;
+    m_cache = cache;
     m_log = logger;
 
     // threshold for firing
@@ -177,11 +175,11 @@ std::unique_ptr<edm4eic::CalorimeterHitCollection> CalorimeterHitReco::process(c
         dd4hep::Position gpos;
         try {
             // global positions
-            gpos = m_converter->position(cellID);
+            gpos = m_cache->position(cellID);
 
             // masked position (look for a mother volume)
             if (gpos_mask != 0) {
-                auto mpos = m_converter->position(cellID & ~gpos_mask);
+                auto mpos = m_cache->position(cellID & ~gpos_mask);
                 // replace corresponding coords
                 for (const char &c : m_cfg.maskPos) {
                     switch (std::tolower(c)) {
@@ -202,8 +200,7 @@ std::unique_ptr<edm4eic::CalorimeterHitCollection> CalorimeterHitReco::process(c
 
             // local positions
             if (m_cfg.localDetElement.empty()) {
-                auto volman = m_detector->volumeManager();
-                local = volman.lookupDetElement(cellID & local_mask);
+                local = m_cache->detElement(cellID & local_mask);
             }
         } catch (...) {
             // Error looking up cellID. Messages should already have been printed.
@@ -219,25 +216,21 @@ std::unique_ptr<edm4eic::CalorimeterHitCollection> CalorimeterHitReco::process(c
         }
 
         const auto pos = local.nominal().worldToLocal(gpos);
-        std::vector<double> cdim;
+        CellIDGeometryCache::Dimensions cdim;
         // get segmentation dimensions
-        auto segmentation_type = m_converter->findReadout(local).segmentation().type();
-        if (segmentation_type == "CartesianGridXY") {
-            auto cell_dim = m_converter->cellDimensions(cellID);
-            cdim.resize(3);
-            cdim[0] = cell_dim[0];
-            cdim[1] = cell_dim[1];
+        const auto segmentation_kind = m_cache->segmentationKind(cellID);
+        if (segmentation_kind == CellIDGeometryCache::SegmentationKind::CartesianGridXY) {
+            auto cell_dim = m_cache->cellDimensions(cellID);
+            cdim = {cell_dim[0], cell_dim[1], 0.};
             m_log->debug("Using segmentation for cell dimensions: {}", fmt::join(cdim, ", "));
         } else {
-            if ((segmentation_type != "NoSegmentation") && (!warned_unsupported_segmentation)) {
-                m_log->warn("Unsupported segmentation type \"{}\"", segmentation_type);
+            if ((segmentation_kind != CellIDGeometryCache::SegmentationKind::NoSegmentation) && (!warned_unsupported_segmentation)) {
+                m_log->warn("Unsupported segmentation type \"{}\"", m_cache->segmentation(cellID).type());
                 warned_unsupported_segmentation = true;
             }
 
             // Using bounding box instead of actual solid so the dimensions are always in dim_x, dim_y, dim_z
-            cdim = m_converter->findContext(cellID)->volumePlacement().volume().boundingBox().dimensions();
-            std::transform(cdim.begin(), cdim.end(), cdim.begin(),
-                           std::bind(std::multiplies<double>(), std::placeholders::_1, 2));
+            cdim = m_cache->volumeDimensions(cellID);
             m_log->debug("Using bounding box for cell dimensions: {}", fmt::join(cdim, ", "));
         }
 
@@ -245,8 +238,8 @@ std::unique_ptr<edm4eic::CalorimeterHitCollection> CalorimeterHitReco::process(c
         //FIXME: needs to come from the geometry service/converter
         const decltype(edm4eic::CalorimeterHitData::position) position(gpos.x() / dd4hep::mm, gpos.y() / dd4hep::mm,
                                                                     gpos.z() / dd4hep::mm);
-        const decltype(edm4eic::CalorimeterHitData::dimension) dimension(cdim.at(0) / dd4hep::mm, cdim.at(1) / dd4hep::mm,
-                                                                      cdim.at(2) / dd4hep::mm);
+        const decltype(edm4eic::CalorimeterHitData::dimension) dimension(cdim[0] / dd4hep::mm, cdim[1] / dd4hep::mm,
+                                                                      cdim[2] / dd4hep::mm);
         const decltype(edm4eic::CalorimeterHitData::local) local_position(pos.x() / dd4hep::mm, pos.y() / dd4hep::mm,
                                                                        pos.z() / dd4hep::mm);
 
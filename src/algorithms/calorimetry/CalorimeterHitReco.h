@@ -10,7 +10,6 @@
 
 #include <DD4hep/DetElement.h>
 #include <DD4hep/Detector.h>
-#include <DDRec/CellIDPositionConverter.h>
 #include <Parsers/Primitives.h>
 #include <edm4eic/CalorimeterHitCollection.h>
 #include <edm4hep/RawCalorimeterHitCollection.h>
@@ -20,6 +19,7 @@
 #include <memory>
 
 #include "CalorimeterHitRecoConfig.h"
+#include "algorithms/interfaces/CellIDGeometryCache.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -27,7 +27,7 @@ namespace eicrecon {
   class CalorimeterHitReco : public WithPodConfig<CalorimeterHitRecoConfig> {
 
   public:
-    void init(const dd4hep::Detector* detector, const dd4hep::rec::CellIDPositionConverter* converter, std::shared_ptr<spdlog::logger>& logger);
+    void init(const dd4hep::Detector* detector, CellIDGeometryCache* cache, std::shared_ptr<spdlog::logger>& logger);
     std::unique_ptr<edm4eic::CalorimeterHitCollection> process(const edm4hep::RawCalorimeterHitCollection &rawhits);
 
   private:
@@ -49,7 +49,7 @@ namespace eicrecon {
 
   private:
     const dd4hep::Detector* m_detector;
-    const dd4hep::rec::CellIDPositionConverter* m_converter;
+    CellIDGeometryCache* m_cache;
     std::shared_ptr<spdlog::logger> m_log;
 
   };
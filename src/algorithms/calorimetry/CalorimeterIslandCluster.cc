@@ -7,14 +7,10 @@
 
 #include <DD4hep/Readout.h>
 #include <Evaluator/DD4hepUnits.h>
-#include <TInterpreter.h>
-#include <TInterpreterValue.h>
 #include <edm4hep/Vector2f.h>
 #include <edm4hep/Vector3f.h>
 #include <fmt/format.h>
 #include <map>
-#include <set>
-#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -28,8 +24,6 @@ using namespace edm4eic;
 
 namespace eicrecon {
 
-unsigned int CalorimeterIslandCluster::function_id = 0;
-
 static double Phi_mpi_pi(double phi) {
   return std::remainder(phi, 2 * M_PI);
 }
@@ -82,6 +76,8 @@ static edm4hep::Vector2f globalDistEtaPhi(const CaloHit &h1, const CaloHit &h2)
 void CalorimeterIslandCluster::init(const dd4hep::Detector* detector, std::shared_ptr<spdlog::logger>& logger) {
     m_log = logger;
     m_detector = detector;
+    m_neighbourIndex.reset();
+    m_adjacencyMatrix.reset();
 
     static std::map<std::string,
                 std::tuple<std::function<edm4hep::Vector2f(const CaloHit&, const CaloHit&)>, std::vector<double>>>
@@ -131,39 +127,13 @@ void CalorimeterIslandCluster::init(const dd4hep::Detector* detector, std::share
       }
       m_idSpec = m_detector->readout(m_cfg.readout).idSpec();
 
-      std::string func_name = fmt::format("_CalorimeterIslandCluster_{}", function_id++);
-      std::ostringstream sstr;
-      sstr << "bool " << func_name << "(double params[]){";
-      unsigned int param_ix = 0;
-      for(const auto &p : m_idSpec.fields()) {
-        const std::string &name = p.first;
-        const dd4hep::IDDescriptor::Field* field = p.second;
-        sstr << "double " << name << "_1 = params[" << (param_ix++) << "];";
-        sstr << "double " << name << "_2 = params[" << (param_ix++) << "];";
-      }
-      sstr << "return " << m_cfg.adjacencyMatrix << ";";
-      sstr << "}";
-      m_log->debug("Compiling {}", sstr.str());
-
-      TInterpreter *interp = TInterpreter::Instance();
-      interp->ProcessLine(sstr.str().c_str());
-      std::unique_ptr<TInterpreterValue> func_val { gInterpreter->MakeInterpreterValue() };
-      interp->Evaluate(func_name.c_str(), *func_val);
-      typedef bool (*func_t)(double params[]);
-      func_t func = ((func_t)(func_val->GetAsPointer()));
-
-      is_neighbour = [this, func, param_ix](const CaloHit &h1, const CaloHit &h2) {
-        std::vector<double> params;
-        params.reserve(param_ix);
-        for(const auto &p : m_idSpec.fields()) {
-          const std::string &name = p.first;
-          const dd4hep::IDDescriptor::Field* field = p.second;
-          params.push_back(field->value(h1.getCellID()));
-          params.push_back(field->value(h2.getCellID()));
-          m_log->trace("{}_1 = {}", name, field->value(h1.getCellID()));
-          m_log->trace("{}_2 = {}", name, field->value(h2.getCellID()));
-        }
-        return func(params.data());
+      // compiled once into a native predicate on the decoded cellID fields
+      m_log->debug("Compiling adjacency matrix {}", m_cfg.adjacencyMatrix);
+      m_adjacencyMatrix.emplace(m_cfg.adjacencyMatrix, m_idSpec);
+      m_log->debug("Adjacency matrix uses {} readout fields", m_adjacencyMatrix->fieldCount());
+
+      is_neighbour = [this](const CaloHit &h1, const CaloHit &h2) {
+        return (*m_adjacencyMatrix)(h1.getCellID(), h2.getCellID());
       };
       method_found = true;
     }
@@ -187,6 +157,13 @@ void CalorimeterIslandCluster::init(const dd4hep::Detector* detector, std::share
             }
           };
 
+          // hits are indexed by the coordinates of the distance method,
+          // so that only nearby hits are tested as neighbours
+          auto metric = CalorimeterHitNeighbourIndex::metricFromName(uprop.first);
+          if (metric) {
+            m_neighbourIndex.emplace(*metric, neighbourDist, m_cfg.sectorDist / dd4hep::mm);
+          }
+
           m_log->info("Using clustering method: {}", uprop.first);
           break;
         }
@@ -217,31 +194,37 @@ void CalorimeterIslandCluster::init(const dd4hep::Detector* detector, std::share
 
 
 std::unique_ptr<edm4eic::ProtoClusterCollection> CalorimeterIslandCluster::process(const edm4eic::CalorimeterHitCollection &hits) {
-    // group neighboring hits
-    std::vector<std::set<std::size_t>> groups;
+    if (m_neighbourIndex) {
+      m_neighbourIndex->build(hits, m_cfg.minClusterHitEdep);
+    }
 
-    std::vector<bool> visits(hits.size(), false);
     for (size_t i = 0; i < hits.size(); ++i) {
+      const auto& hit = hits[i];
+      m_log->debug("hit {:d}: energy = {:.4f} MeV, local = ({:.4f}, {:.4f}) mm, global=({:.4f}, {:.4f}, {:.4f}) mm", i, hit.getEnergy() * 1000., hit.getLocal().x, hit.getLocal().y, hit.getPosition().x,  hit.getPosition().y, hit.getPosition().z);
+    }
 
-      {
-        const auto& hit = hits[i];
-        m_log->debug("hit {:d}: energy = {:.4f} MeV, local = ({:.4f}, {:.4f}) mm, global=({:.4f}, {:.4f}, {:.4f}) mm", i, hit.getEnergy() * 1000., hit.getLocal().x, hit.getLocal().y, hit.getPosition().x,  hit.getPosition().y, hit.getPosition().z);
-      }
-      // already in a group
-      if (visits[i]) {
-        continue;
-      }
-      groups.emplace_back();
-      // create a new group, and group all the neighboring hits
-      bfs_group(hits, groups.back(), i, visits);
+    // group neighboring hits
+    auto qualified = [&hits, this](std::size_t idx) {
+      // only hits above threshold participate in clustering
+      return !(hits[idx].getEnergy() < m_cfg.minClusterHitEdep);
+    };
+    auto neighbours = [&hits, this](std::size_t idx1, std::size_t idx2) {
+      return is_neighbour(hits[idx1], hits[idx2]);
+    };
+    if (m_neighbourIndex) {
+      auto candidates = [this](std::size_t idx, auto&& visit) {
+        m_neighbourIndex->for_each_candidate(idx, visit);
+      };
+      m_components.compute(hits.size(), qualified, candidates, neighbours);
+    } else {
+      m_components.compute(hits.size(), qualified, neighbours);
     }
+    m_components.collect();
 
     auto protoClusters = std::make_unique<edm4eic::ProtoClusterCollection>();
 
-    for (auto& group : groups) {
-      if (group.empty()) {
-        continue;
-      }
+    for (std::size_t k = 0; k < m_components.size(); ++k) {
+      const auto group = m_components[k];
       auto maxima = find_maxima(hits, group, !m_cfg.splitCluster);
       split_group(hits, group, maxima, protoClusters.get());
 
@@ -18,10 +18,13 @@
 #include <exception>
 #include <functional>
 #include <memory>
-#include <set>
+#include <optional>
 #include <vector>
 
+#include "AdjacencyMatrixExpression.h"
+#include "CalorimeterHitNeighbourIndex.h"
 #include "CalorimeterIslandClusterConfig.h"
+#include "ConnectedComponents.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -56,41 +59,17 @@ namespace eicrecon {
 
   private:
 
-    static unsigned int function_id;
+    // native evaluation of the adjacency matrix expression, if configured
+    std::optional<AdjacencyMatrixExpression> m_adjacencyMatrix;
 
-    // grouping function with Breadth-First Search
-    void bfs_group(const edm4eic::CalorimeterHitCollection &hits, std::set<std::size_t> &group, std::size_t idx, std::vector<bool> &visits) const {
-      visits[idx] = true;
+    // spatial index of the hits in the current event, only for coordinate distance methods
+    std::optional<CalorimeterHitNeighbourIndex> m_neighbourIndex;
 
-      // not a qualified hit to particpate clustering, stop here
-      if (hits[idx].getEnergy() < m_cfg.minClusterHitEdep) {
-        return;
-      }
-
-      group.insert(idx);
-      size_t prev_size = 0;
-
-      while (prev_size != group.size()) {
-        prev_size = group.size();
-        for (std::size_t idx1 : group) {
-          // check neighbours
-          for (std::size_t idx2 = 0; idx2 < hits.size(); ++idx2) {
-            // not a qualified hit to particpate clustering, skip
-            if (hits[idx2].getEnergy() < m_cfg.minClusterHitEdep) {
-              continue;
-            }
-            if ((!visits[idx2])
-                && is_neighbour(hits[idx1], hits[idx2])) {
-              group.insert(idx2);
-              visits[idx2] = true;
-            }
-          }
-        }
-      }
-    }
+    // grouping of neighbouring hits, storage reused between events
+    ConnectedComponents m_components;
 
     // find local maxima that above a certain threshold
-  std::vector<std::size_t> find_maxima(const edm4eic::CalorimeterHitCollection &hits, const std::set<std::size_t> &group, bool global = false) const {
+  std::vector<std::size_t> find_maxima(const edm4eic::CalorimeterHitCollection &hits, const ConnectedComponents::Group &group, bool global = false) const {
     std::vector<std::size_t> maxima;
     if (group.empty()) {
       return maxima;
@@ -116,15 +95,20 @@ namespace eicrecon {
       }
 
       bool maximum = true;
-      for (std::size_t idx2 : group) {
-        if (idx1 == idx2) {
-          continue;
+      auto check = [&](std::size_t idx2) {
+        if (!maximum || idx1 == idx2) {
+          return;
         }
 
         if (is_neighbour(hits[idx1], hits[idx2]) && (hits[idx2].getEnergy() > hits[idx1].getEnergy())) {
           maximum = false;
-          break;
         }
+      };
+      if (m_neighbourIndex) {
+        // qualified neighbours of a group member are all in the group
+        m_neighbourIndex->for_each_candidate(idx1, check);
+      } else {
+        std::for_each(group.begin(), group.end(), check);
       }
 
       if (maximum) {
@@ -147,7 +131,7 @@ namespace eicrecon {
 
     // split a group of hits according to the local maxima
     //TODO: confirm protoclustering without protoclustercollection
-  void split_group(const edm4eic::CalorimeterHitCollection &hits, std::set<std::size_t>& group, const std::vector<std::size_t>& maxima, edm4eic::ProtoClusterCollection *protoClusters) const {
+  void split_group(const edm4eic::CalorimeterHitCollection &hits, const ConnectedComponents::Group& group, const std::vector<std::size_t>& maxima, edm4eic::ProtoClusterCollection *protoClusters) const {
     // special cases
     if (maxima.empty()) {
       m_log->debug("No maxima found, not building any clusters");
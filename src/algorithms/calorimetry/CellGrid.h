@@ -0,0 +1,79 @@
+// Copyright (C) 2023 Wouter Deconinck
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace eicrecon {
+
+  /** Hit indices binned in an N-dimensional grid of integer cells.
+   *
+   * Entries are kept in a flat vector sorted by cell, so that a cell lookup is
+   * a binary search and no per-cell allocations are made. Storage is reused
+   * between events.
+   */
+  template<std::size_t N>
+  class CellGrid {
+
+  public:
+    using Key = std::array<std::int64_t, N>;
+
+    /// Cell index of coordinate x in bins of the given width
+    static std::int64_t bin(double x, double width) {
+      // clamped, so that the neighbouring cells never overflow
+      constexpr double max_bin = 1099511627776.; // 2^40
+      const double v = std::floor(x / width);
+      if (std::isnan(v)) {
+        return 0;
+      }
+      return static_cast<std::int64_t>(std::clamp(v, -max_bin, max_bin));
+    }
+
+    /** Bin width for a neighbour reach.
+     *
+     * Widened beyond the reach to absorb the single precision rounding of
+     * hit coordinates up to max_abs_coordinate, and of the distances computed
+     * from them, so that neighbours are always in adjacent cells.
+     */
+    static double padded_width(double reach, double max_abs_coordinate) {
+      return std::abs(reach) * (1. + 1e-4) + 4. * FLT_EPSILON * max_abs_coordinate;
+    }
+
+    void clear() {
+      m_entries.clear();
+    }
+
+    void insert(const Key& cell, std::size_t idx) {
+      m_entries.emplace_back(cell, idx);
+    }
+
+    /// Must be called after the last insert and before any lookup
+    void sort() {
+      // sorting by (cell, index) keeps the hits of a cell in hit order
+      std::sort(m_entries.begin(), m_entries.end());
+    }
+
+    template<typename Visitor>
+    void for_each_in_cell(const Key& cell, Visitor&& visit) const {
+      auto it = std::lower_bound(m_entries.begin(), m_entries.end(), cell,
+                                 [](const Entry& e, const Key& k) { return e.first < k; });
+      for (; it != m_entries.end() && it->first == cell; ++it) {
+        visit(it->second);
+      }
+    }
+
+  private:
+    using Entry = std::pair<Key, std::size_t>;
+
+    std::vector<Entry> m_entries;
+  };
+
+} // namespace eicrecon
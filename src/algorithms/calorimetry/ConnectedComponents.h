@@ -0,0 +1,182 @@
+// Copyright (C) 2023 Wouter Deconinck
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace eicrecon {
+
+  /** Connected components of the hits of one event.
+   *
+   * Hits are identified by their index in the collection. Neighbouring hits are
+   * merged with a union-find over a flat parent array, with path compression
+   * and union by size. The neighbour predicate is pluggable, as is the
+   * enumeration of the candidate neighbours of a hit, which allows a spatial
+   * index to be used instead of testing all pairs.
+   *
+   * The neighbour relation is assumed to be symmetric: each pair of hits is
+   * tested only once, from the lower index. Storage is reused between events.
+   */
+  class ConnectedComponents {
+
+  public:
+    /// A component, as the ascending hit indices of its members
+    class Group {
+    public:
+      Group(const std::size_t* first, const std::size_t* last) : m_first(first), m_last(last) {}
+      const std::size_t* begin() const { return m_first; }
+      const std::size_t* end() const { return m_last; }
+      std::size_t size() const { return m_last - m_first; }
+      bool empty() const { return m_first == m_last; }
+      std::size_t operator[](std::size_t i) const { return m_first[i]; }
+    private:
+      const std::size_t* m_first;
+      const std::size_t* m_last;
+    };
+
+    /** Link the included hits among [0, n) that are neighbours.
+     *
+     * included(i) selects the hits taking part in the grouping,
+     * candidates(i, visit) calls visit(j) for every potential neighbour j of i,
+     * is_neighbour(i, j) decides whether two included hits are neighbours.
+     * The candidates must contain all neighbours and must themselves be
+     * symmetric, i.e. if j is a candidate of i then i is a candidate of j.
+     */
+    template<typename Included, typename Candidates, typename Neighbour>
+    void compute(std::size_t n, Included&& included, Candidates&& candidates, Neighbour&& is_neighbour) {
+      reset(n, included);
+      for (std::size_t i = 0; i < n; ++i) {
+        if (!m_included[i]) {
+          continue;
+        }
+        candidates(i, [&](std::size_t j) {
+          if (j <= i || !m_included[j]) {
+            return;
+          }
+          // skip the predicate when the hits are already connected
+          if (find(i) != find(j) && is_neighbour(i, j)) {
+            unite(i, j);
+          }
+        });
+      }
+    }
+
+    /// Link the included hits among [0, n) testing all pairs
+    template<typename Included, typename Neighbour>
+    void compute(std::size_t n, Included&& included, Neighbour&& is_neighbour) {
+      reset(n, included);
+      for (std::size_t i = 0; i < n; ++i) {
+        if (!m_included[i]) {
+          continue;
+        }
+        for (std::size_t j = i + 1; j < n; ++j) {
+          if (m_included[j] && find(i) != find(j) && is_neighbour(i, j)) {
+            unite(i, j);
+          }
+        }
+      }
+    }
+
+    /** Collect the components after compute().
+     *
+     * Only components with at least one hit for which seed(i) holds are kept.
+     * They are ordered by their lowest seed index, which reproduces the order
+     * of a search started from every seed in turn.
+     */
+    template<typename Seed>
+    void collect(Seed&& seed) {
+      const std::size_t n = m_parent.size();
+      m_groupOfRoot.assign(n, npos);
+      m_offsets.assign(1, 0);
+      for (std::size_t i = 0; i < n; ++i) {
+        if (m_included[i] && seed(i)) {
+          std::size_t& group = m_groupOfRoot[find(i)];
+          if (group == npos) {
+            group = m_offsets.size() - 1;
+            m_offsets.push_back(0);
+          }
+        }
+      }
+
+      // counting sort of the members by group, ascending within each group
+      for (std::size_t i = 0; i < n; ++i) {
+        if (m_included[i] && m_groupOfRoot[find(i)] != npos) {
+          ++m_offsets[m_groupOfRoot[find(i)] + 1];
+        }
+      }
+      std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+      m_members.resize(m_offsets.back());
+      m_fill.assign(m_offsets.begin(), m_offsets.end() - 1);
+      for (std::size_t i = 0; i < n; ++i) {
+        if (m_included[i] && m_groupOfRoot[find(i)] != npos) {
+          m_members[m_fill[m_groupOfRoot[find(i)]]++] = i;
+        }
+      }
+    }
+
+    /// Collect all components, ordered by their lowest hit index
+    void collect() {
+      collect([](std::size_t) { return true; });
+    }
+
+    std::size_t size() const { return m_offsets.size() - 1; }
+
+    Group operator[](std::size_t k) const {
+      return {m_members.data() + m_offsets[k], m_members.data() + m_offsets[k + 1]};
+    }
+
+    std::size_t find(std::size_t i) {
+      // path halving
+      while (m_parent[i] != i) {
+        m_parent[i] = m_parent[m_parent[i]];
+        i = m_parent[i];
+      }
+      return i;
+    }
+
+    void unite(std::size_t i, std::size_t j) {
+      i = find(i);
+      j = find(j);
+      if (i == j) {
+        return;
+      }
+      if (m_size[i] < m_size[j]) {
+        std::swap(i, j);
+      }
+      m_parent[j] = i;
+      m_size[i] += m_size[j];
+    }
+
+  private:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    template<typename Included>
+    void reset(std::size_t n, Included& included) {
+      m_parent.resize(n);
+      std::iota(m_parent.begin(), m_parent.end(), 0);
+      m_size.assign(n, 1);
+      m_included.resize(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        m_included[i] = included(i);
+      }
+      m_offsets.assign(1, 0);
+      m_members.clear();
+    }
+
+    std::vector<std::size_t> m_parent;
+    std::vector<std::size_t> m_size;
+    std::vector<char> m_included;
+
+    // components in compressed row storage
+    std::vector<std::size_t> m_groupOfRoot;
+    std::vector<std::size_t> m_offsets{0};
+    std::vector<std::size_t> m_members;
+    std::vector<std::size_t> m_fill;
+  };
+
+} // namespace eicrecon
@@ -26,6 +26,8 @@
 #include <edm4hep/utils/vector_utils.h>
 
 #include "algorithms/interfaces/WithPodConfig.h"
+#include "CalorimeterHitLayerIndex.h"
+#include "ConnectedComponents.h"
 #include "ImagingTopoClusterConfig.h"
 
 namespace eicrecon {
@@ -88,35 +90,40 @@ namespace eicrecon {
                     "Global distance between hits <= {:.4f} mm.",
                     sectorDist
         );
+
+        m_index.init({localDistXY[0], localDistXY[1]}, {layerDistEtaPhi[0], layerDistEtaPhi[1]}, m_cfg.neighbourLayersRange, sectorDist);
     }
 
     std::unique_ptr<edm4eic::ProtoClusterCollection> process(const edm4eic::CalorimeterHitCollection& hits) {
 
         auto proto = std::make_unique<edm4eic::ProtoClusterCollection>();
 
-        // group neighbouring hits
-        std::vector<bool> visits(hits.size(), false);
-        std::vector<std::set<std::size_t>> groups;
-        for (size_t i = 0; i < hits.size(); ++i) {
-            m_log->debug("hit {:d}: local position = ({}, {}, {}), global position = ({}, {}, {})", i + 1,
-                         hits[i].getLocal().x, hits[i].getLocal().y, hits[i].getPosition().z,
-                         hits[i].getPosition().x, hits[i].getPosition().y, hits[i].getPosition().z
-            );
-            // already in a group, or not energetic enough to form a cluster
-            if (visits[i] || hits[i].getEnergy() < minClusterCenterEdep) {
-                continue;
-            }
-            // create a new group, and group all the neighbouring hits
-            groups.emplace_back();
-            bfs_group(hits, groups.back(), i, visits);
-        }
-        m_log->debug("found {} potential clusters (groups of hits)", groups.size());
-        for (size_t i = 0; i < groups.size(); ++i) {
-            m_log->debug("group {}: {} hits", i, groups[i].size());
+        // index hits by sector and layer, with their positions precomputed
+        m_index.build(hits, m_cfg.minClusterHitEdep);
+
+        // group neighbouring hits, keeping groups with a hit energetic enough to seed a cluster
+        m_components.compute(hits.size(),
+            [&hits, this](std::size_t idx) {
+                // only hits above threshold participate in clustering
+                return !(hits[idx].getEnergy() < m_cfg.minClusterHitEdep);
+            },
+            [this](std::size_t idx, auto&& visit) {
+                m_index.for_each_candidate(idx, visit);
+            },
+            [this](std::size_t idx1, std::size_t idx2) {
+                return is_neighbour(idx1, idx2);
+            });
+        m_components.collect([&hits, this](std::size_t idx) {
+            return !(hits[idx].getEnergy() < minClusterCenterEdep);
+        });
+        m_log->debug("found {} potential clusters (groups of hits)", m_components.size());
+        for (size_t i = 0; i < m_components.size(); ++i) {
+            m_log->debug("group {}: {} hits", i, m_components[i].size());
         }
 
         // form clusters
-        for (const auto &group : groups) {
+        for (std::size_t k = 0; k < m_components.size(); ++k) {
+            const auto group = m_components[k];
             if (static_cast<int>(group.size()) < m_cfg.minClusterNhits) {
                 continue;
             }
@@ -139,61 +146,38 @@ namespace eicrecon {
 
   private:
 
-    // helper function to group hits
-    bool is_neighbour(const edm4eic::CalorimeterHit& h1, const edm4eic::CalorimeterHit& h2) const {
+    // helper function to group hits, using the quantities precomputed in the index
+    bool is_neighbour(std::size_t idx1, std::size_t idx2) const {
+        const auto& h1 = m_index[idx1];
+        const auto& h2 = m_index[idx2];
+
         // different sectors, simple distance check
-        if (h1.getSector() != h2.getSector()) {
-            return std::hypot((h1.getPosition().x - h2.getPosition().x),
-                              (h1.getPosition().y - h2.getPosition().y),
-                              (h1.getPosition().z - h2.getPosition().z)) <= sectorDist;
+        if (h1.sector != h2.sector) {
+            return std::hypot((h1.position.x - h2.position.x),
+                              (h1.position.y - h2.position.y),
+                              (h1.position.z - h2.position.z)) <= sectorDist;
         }
 
         // layer check
-        int ldiff = std::abs(h1.getLayer() - h2.getLayer());
+        int ldiff = std::abs(h1.layer - h2.layer);
         // same layer, check local positions
         if (ldiff == 0) {
-            return (std::abs(h1.getLocal().x - h2.getLocal().x) <= localDistXY[0]) &&
-                   (std::abs(h1.getLocal().y - h2.getLocal().y) <= localDistXY[1]);
+            return (std::abs(h1.local.x - h2.local.x) <= localDistXY[0]) &&
+                   (std::abs(h1.local.y - h2.local.y) <= localDistXY[1]);
         } else if (ldiff <= m_cfg.neighbourLayersRange) {
-            return (std::abs(edm4hep::utils::eta(h1.getPosition()) - edm4hep::utils::eta(h2.getPosition())) <= layerDistEtaPhi[0]) &&
-                   (std::abs(edm4hep::utils::angleAzimuthal(h1.getPosition()) - edm4hep::utils::angleAzimuthal(h2.getPosition())) <=
-                    layerDistEtaPhi[1]);
+            return (std::abs(h1.eta - h2.eta) <= layerDistEtaPhi[0]) &&
+                   (std::abs(h1.phi - h2.phi) <= layerDistEtaPhi[1]);
         }
 
         // not in adjacent layers
         return false;
     }
 
-    // grouping function with Breadth-First Search
-    void bfs_group(const edm4eic::CalorimeterHitCollection &hits, std::set<std::size_t> &group, std::size_t idx, std::vector<bool> &visits) const {
-      visits[idx] = true;
-
-      // not a qualified hit to particpate clustering, stop here
-      if (hits[idx].getEnergy() < m_cfg.minClusterHitEdep) {
-        return;
-      }
-
-      group.insert(idx);
-      size_t prev_size = 0;
-
-      while (prev_size != group.size()) {
-        prev_size = group.size();
-        for (std::size_t idx1 : group) {
-          // check neighbours
-          for (std::size_t idx2 = 0; idx2 < hits.size(); ++idx2) {
-            // not a qualified hit to particpate clustering, skip
-            if (hits[idx2].getEnergy() < m_cfg.minClusterHitEdep) {
-              continue;
-            }
-            if ((!visits[idx2])
-                && is_neighbour(hits[idx1], hits[idx2])) {
-              group.insert(idx2);
-              visits[idx2] = true;
-            }
-          }
-        }
-      }
-    }
+    // hits of the current event by sector and layer
+    CalorimeterHitLayerIndex m_index;
+
+    // grouping of neighbouring hits, storage reused between events
+    ConnectedComponents m_components;
   };
 
 } // namespace eicrecon
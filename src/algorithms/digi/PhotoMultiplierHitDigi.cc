@@ -46,6 +46,10 @@ void eicrecon::PhotoMultiplierHitDigi::AlgorithmInit(const dd4hep::Detector* det
      */
     if(m_cfg.seed==0) m_log->warn("using seed=0 may cause thread-unsafe behavior of TRandom (EICrecon issue 539)");
 
+    // each crosstalk avalanche triggers another one with this probability, so it must be < 1
+    if(!(m_cfg.crosstalkProbability >= 0 && m_cfg.crosstalkProbability < 1))
+      throw std::runtime_error(fmt::format("PhotoMultiplierHitDigi: crosstalkProbability={} is outside of the allowed range [0,1)", m_cfg.crosstalkProbability));
+
     // random number generators
     m_random.SetSeed(m_cfg.seed);
     m_rngNorm = [&](){
@@ -112,7 +116,8 @@ eicrecon::PhotoMultiplierHitDigiResult eicrecon::PhotoMultiplierHitDigi::Algorit
             m_log->trace(" -> hit accepted");
             m_log->trace(" -> MC hit id={}", sim_hit.getObjectID().index);
             auto   time = sim_hit.getTime();
-            double amp  = m_cfg.speMean + m_rngNorm() * m_cfg.speError;
+            auto   npe  = CrosstalkNpe();
+            double amp  = Amplitude(npe);
 
             // insert hit to `hit_groups`
             InsertHit(
@@ -120,7 +125,9 @@ eicrecon::PhotoMultiplierHitDigiResult eicrecon::PhotoMultiplierHitDigi::Algorit
                 id,
                 amp,
                 time,
-                sim_hit_index
+                sim_hit_index,
+                false,
+                npe
                 );
         }
 
@@ -135,29 +142,33 @@ eicrecon::PhotoMultiplierHitDigiResult eicrecon::PhotoMultiplierHitDigi::Algorit
             }
         }
 
-        //build noise raw hits
-        if (m_cfg.enableNoise) {
+        // build noise raw hits: the number of noise hits is Poisson distributed, and their
+        // pixels and times are sampled directly, so the cost scales with the noise occupancy
+        if (m_cfg.enableNoise && m_noise_cellIDs && !m_noise_cellIDs->empty()) {
           m_log->trace("{:=^70}"," BEGIN NOISE INJECTION ");
-          float p = m_cfg.noiseRate*m_cfg.noiseTimeWindow;
-          auto cellID_action = [this,&hit_groups] (auto id) {
-
-            // cell time, signal amplitude
-            double   amp  = m_cfg.speMean + m_rngNorm()*m_cfg.speError;
+          auto num_cells = m_noise_cellIDs->size();
+          auto mean_num_noise_hits = m_cfg.noiseRate / dd4hep::s * m_cfg.noiseTimeWindow * num_cells;
+          auto num_noise_hits = m_random.Poisson(mean_num_noise_hits);
+          m_log->trace("{} noise hits (mean {:.4})", num_noise_hits, mean_num_noise_hits);
+          for (decltype(num_noise_hits) i = 0; i < num_noise_hits; i++) {
+
+            // pixel, cell time, signal amplitude
+            auto     id   = (*m_noise_cellIDs)[m_random.Integer(static_cast<UInt_t>(num_cells))];
             TimeType time = m_cfg.noiseTimeWindow*m_rngUni() / dd4hep::ns;
-            dd4hep::Position pos_hit_global = m_converter->position(id);
+            auto     npe  = CrosstalkNpe();
+            double   amp  = Amplitude(npe);
 
             // insert in `hit_groups`, or if the pixel already has a hit, update `npe` and `signal`
-            this->InsertHit(
+            InsertHit(
                 hit_groups,
                 id,
                 amp,
                 time,
                 0, // not used
-                true
+                true,
+                npe
                 );
-
-          };
-          m_VisitRngCellIDs(cellID_action, p);
+          }
         }
 
         // build output `RawTrackerHit` and `MCRecoTrackerHitAssociation` collections
@@ -224,51 +235,51 @@ void  eicrecon::PhotoMultiplierHitDigi::qe_init()
         if (qeff.back().first < 3.0) {
             m_log->warn("Quantum efficiency data end at {:.2f} {}", qeff.back().first, " eV, maybe you are using wrong units?");
         }
-}
-
 
-template<class RndmIter, typename T, class Compare> RndmIter  eicrecon::PhotoMultiplierHitDigi::interval_search(RndmIter beg, RndmIter end, const T &val, Compare comp) const
-{
-        // special cases
-        auto dist = std::distance(beg, end);
-        if ((dist < 2) || (comp(*beg, val) > 0) || (comp(*std::prev(end), val) < 0)) {
-            return end;
+        // build the lookup bins, no wider than the narrowest nonzero interval
+        double min_interval = qeff.back().first - qeff.front().first;
+        for (std::size_t i = 0; i + 1 < qeff.size(); i++) {
+            auto interval = qeff[i+1].first - qeff[i].first;
+            if (interval > 0) min_interval = std::min(min_interval, interval);
         }
-        auto mid = std::next(beg, dist / 2);
-
-        while (mid != end) {
-            if (comp(*mid, val) == 0) {
-                return mid;
-            } else if (comp(*mid, val) > 0) {
-                end = mid;
-            } else {
-                beg = std::next(mid);
-            }
-            mid = std::next(beg, std::distance(beg, end)/2);
+        qe_bin_min = qeff.front().first;
+        std::size_t num_bins = 1;
+        if (min_interval > 0) {
+            num_bins = std::clamp(static_cast<std::size_t>(std::ceil((qeff.back().first - qe_bin_min) / min_interval)), std::size_t{1}, std::size_t{10000});
         }
-
-        if (mid == end || comp(*mid, val) > 0) {
-            return std::prev(mid);
+        qe_bin_width = min_interval > 0 ? (qeff.back().first - qe_bin_min) / num_bins : 1.0;
+        qe_bins.resize(num_bins);
+        std::size_t i = 0;
+        for (std::size_t bin = 0; bin < num_bins; bin++) {
+            auto bin_edge = qe_bin_min + bin * qe_bin_width;
+            while (i + 1 < qeff.size() && qeff[i+1].first <= bin_edge) {
+                i++;
+            }
+            qe_bins[bin] = i;
         }
-        return mid;
 }
 
+
 bool  eicrecon::PhotoMultiplierHitDigi::qe_pass(double ev, double rand) const
 {
-        auto it = interval_search(qeff.begin(), qeff.end(), ev,
-                    [] (const std::pair<double, double> &vals, double val) {
-                        return vals.first - val;
-                    });
-
-        if (it == qeff.end()) {
+        // energies outside the QE data range (or NaN) have 0% efficiency
+        if (qeff.size() < 2 || !(ev >= qeff.front().first && ev <= qeff.back().first)) {
             // m_log->warn("{} eV is out of QE data range, assuming 0\% efficiency",ev);
             return false;
         }
 
-        double prob = it->second;
-        auto itn = std::next(it);
-        if (itn != qeff.end() && (itn->first - it->first != 0)) {
-            prob = (it->second*(itn->first - ev) + itn->second*(ev - it->first)) / (itn->first - it->first);
+        // find the interval `[qeff[i],qeff[i+1])` containing `ev`, starting from its lookup bin
+        auto bin = std::min(static_cast<std::size_t>((ev - qe_bin_min) / qe_bin_width), qe_bins.size() - 1);
+        auto i   = qe_bins[bin];
+        while (i + 1 < qeff.size() && qeff[i+1].first <= ev) {
+            i++;
+        }
+
+        double prob = qeff[i].second;
+        if (i + 1 < qeff.size() && (qeff[i+1].first - qeff[i].first != 0)) {
+            const auto &it  = qeff[i];
+            const auto &itn = qeff[i+1];
+            prob = (it.second*(itn.first - ev) + itn.second*(ev - it.first)) / (itn.first - it.first);
         }
 
         // m_log->trace("{} eV, QE: {}\%",ev,prob*100.);
@@ -284,7 +295,8 @@ void eicrecon::PhotoMultiplierHitDigi::InsertHit(
     double           amp,
     TimeType         time,
     std::size_t      sim_hit_index,
-    bool             is_noise_hit
+    bool             is_noise_hit,
+    uint32_t         npe
     ) // NOLINTEND(bugprone-easily-swappable-parameters)
 {
   auto it = hit_groups.find(id);
@@ -293,7 +305,7 @@ void eicrecon::PhotoMultiplierHitDigi::InsertHit(
     for (auto ghit = it->second.begin(); ghit != it->second.end(); ++ghit, ++i) {
       if (std::abs(time - ghit->time) <= (m_cfg.hitTimeWindow)) {
         // hit group found, update npe, signal, and list of MC hits
-        ghit->npe += 1;
+        ghit->npe += npe;
         ghit->signal += amp;
         if(!is_noise_hit) ghit->sim_hit_indices.push_back(sim_hit_index);
         m_log->trace(" -> add to group @ {:#018X}: signal={}", id, ghit->signal);
@@ -305,7 +317,7 @@ void eicrecon::PhotoMultiplierHitDigi::InsertHit(
       auto sig = amp + m_cfg.pedMean + m_cfg.pedError * m_rngNorm();
       decltype(HitData::sim_hit_indices) indices;
       if(!is_noise_hit) indices.push_back(sim_hit_index);
-      hit_groups.insert({ id, {HitData{1, sig, time, indices}} });
+      hit_groups.insert({ id, {HitData{npe, sig, time, indices}} });
       m_log->trace(" -> no group found,");
       m_log->trace("    so new group @ {:#018X}: signal={}", id, sig);
     }
@@ -313,7 +325,30 @@ void eicrecon::PhotoMultiplierHitDigi::InsertHit(
     auto sig = amp + m_cfg.pedMean + m_cfg.pedError * m_rngNorm();
     decltype(HitData::sim_hit_indices) indices;
     if(!is_noise_hit) indices.push_back(sim_hit_index);
-    hit_groups.insert({ id, {HitData{1, sig, time, indices}} });
+    hit_groups.insert({ id, {HitData{npe, sig, time, indices}} });
     m_log->trace(" -> new group @ {:#018X}: signal={}", id, sig);
   }
 }
+
+
+// number of photoelectrons of one primary avalanche: with probability `crosstalkProbability`,
+// each avalanche triggers one more, correlated avalanche in the same pixel
+uint32_t eicrecon::PhotoMultiplierHitDigi::CrosstalkNpe()
+{
+  uint32_t npe = 1;
+  if (m_cfg.crosstalkProbability > 0) {
+    while (m_rngUni() < m_cfg.crosstalkProbability)
+      npe++;
+  }
+  return npe;
+}
+
+
+// signal amplitude of `npe` photoelectrons
+double eicrecon::PhotoMultiplierHitDigi::Amplitude(uint32_t npe)
+{
+  double amp = 0.0;
+  for (uint32_t i = 0; i < npe; i++)
+    amp += m_cfg.speMean + m_rngNorm() * m_cfg.speError;
+  return amp;
+}
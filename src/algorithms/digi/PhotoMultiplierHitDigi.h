@@ -71,13 +71,12 @@ public:
     std::function<double()> m_rngUni;
     //Rndm::Numbers m_rngUni, m_rngNorm;
 
-    // set `m_VisitAllRngPixels`, a visitor to run an action (type
-    // `function<void(cellID)>`) on a selection of random CellIDs; must be
-    // defined externally, since this would be detector-specific
-    void SetVisitRngCellIDs(
-        std::function< void(std::function<void(CellIDType)>, float) > visitor
+    // set `m_noise_cellIDs`, the list of all readout pixels on which noise hits are
+    // generated; must be defined externally, since this would be detector-specific
+    void SetNoiseCellIDs(
+        std::shared_ptr<const std::vector<CellIDType>> cellIDs
         )
-    { m_VisitRngCellIDs = visitor; }
+    { m_noise_cellIDs = cellIDs; }
 
     // set `m_PixelGapMask`, which takes `cellID` and MC hit position, returning
     // true if the hit position is on a pixel, or false if on a pixel gap; must be
@@ -89,9 +88,8 @@ public:
 
 protected:
 
-    // visitor of all possible CellIDs (set with SetVisitRngCellIDs)
-    std::function< void(std::function<void(CellIDType)>, float) > m_VisitRngCellIDs =
-      [] ( std::function<void(CellIDType)> visitor_action, float p ) { /* default no-op */ };
+    // all readout pixels, for noise generation (set with SetNoiseCellIDs)
+    std::shared_ptr<const std::vector<CellIDType>> m_noise_cellIDs;
 
     // pixel gap mask
     std::function< bool(CellIDType, dd4hep::Position) > m_PixelGapMask =
@@ -109,9 +107,16 @@ private:
         double           amp,
         TimeType         time,
         std::size_t      sim_hit_index,
-        bool             is_noise_hit = false
+        bool             is_noise_hit = false,
+        uint32_t         npe = 1
         );
 
+    // number of photoelectrons of one primary avalanche, including its correlated crosstalk avalanches
+    uint32_t CrosstalkNpe();
+
+    // signal amplitude of `npe` photoelectrons
+    double Amplitude(uint32_t npe);
+
     const dd4hep::Detector* m_detector = nullptr;
     const dd4hep::rec::CellIDPositionConverter* m_converter;
 
@@ -122,7 +127,12 @@ private:
 
     std::vector<std::pair<double, double>> qeff;
     void qe_init();
-    template<class RndmIter, typename T, class Compare> RndmIter interval_search(RndmIter beg, RndmIter end, const T &val, Compare comp) const;
     bool qe_pass(double ev, double rand) const;
+
+    // uniformly binned lookup of `qeff`: `qe_bins[b]` is the index of the `qeff` interval
+    // containing the lower edge of bin `b`, which is at most a step or two from the interval of any energy in the bin
+    std::vector<std::size_t> qe_bins;
+    double qe_bin_min   = 0.0;
+    double qe_bin_width = 1.0;
 };
 }
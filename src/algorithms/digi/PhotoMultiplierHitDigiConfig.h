@@ -29,6 +29,10 @@ namespace eicrecon {
       double noiseRate       = 20000; // [Hz]
       double noiseTimeWindow = 20.0;  // [ns]
 
+      // optical crosstalk: probability that an avalanche triggers one more, correlated avalanche
+      // in the same pixel, applied to each photon and noise hit; set to 0 to disable
+      double crosstalkProbability = 0.0; // allowed range: [0,1)
+
       // SiPM pixels
       bool   enablePixelGaps = false; // enable/disable removal of hits in gaps between pixels
 
@@ -90,6 +94,7 @@ namespace eicrecon {
         print_param("enableNoise",enableNoise);
         print_param("noiseRate",noiseRate);
         print_param("noiseTimeWindow",noiseTimeWindow);
+        print_param("crosstalkProbability",crosstalkProbability);
         m_log->log(lvl, "{:-^60}"," Quantum Efficiency vs. Wavelength ");
         for(auto& [wl,qe] : quantumEfficiency)
           m_log->log(lvl, "  {:>10} {:<}",wl,qe);
@@ -8,7 +8,6 @@
 #include <DD4hep/Alignments.h>
 #include <DD4hep/DetElement.h>
 #include <DD4hep/Objects.h>
-#include <DD4hep/VolumeManager.h>
 #include <Evaluator/DD4hepUnits.h>
 #include <Math/GenVector/DisplacementVector3D.h>
 #include <edm4hep/Vector3f.h>
@@ -19,12 +18,12 @@
 #include "algorithms/fardetectors/MatrixTransferStaticConfig.h"
 
 void eicrecon::MatrixTransferStatic::init(const dd4hep::Detector* det,
-                                          const dd4hep::rec::CellIDPositionConverter* id_conv,
+                                          CellIDGeometryCache* cache,
                                           std::shared_ptr<spdlog::logger> &logger) {
 
   m_log       = logger;
   m_detector  = det;
-  m_converter = id_conv;
+  m_cache     = cache;
   //Calculate inverse of static transfer matrix
   std::vector<std::vector<double>> aX(m_cfg.aX);
   std::vector<std::vector<double>> aY(m_cfg.aY);
@@ -77,10 +76,9 @@ std::unique_ptr<edm4eic::ReconstructedParticleCollection> eicrecon::MatrixTransf
 
     auto cellID = h.getCellID();
     // The actual hit position in Global Coordinates
-    auto gpos = m_converter->position(cellID);
+    auto gpos = m_cache->position(cellID);
     // local positions
-    auto volman = m_detector->volumeManager();
-    auto local = volman.lookupDetElement(cellID);
+    auto local = m_cache->detElement(cellID);
 
     auto pos0 = local.nominal().worldToLocal(dd4hep::Position(gpos.x(), gpos.y(), gpos.z())); // hit position in local coordinates
 
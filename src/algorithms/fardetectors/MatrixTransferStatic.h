@@ -4,13 +4,13 @@
 // This converted from: https://eicweb.phy.anl.gov/EIC/juggler/-/blob/master/JugReco/src/components/FarForwardParticles.cpp
 
 #include <DD4hep/Detector.h>
-#include <DDRec/CellIDPositionConverter.h>
 #include <edm4eic/ReconstructedParticleCollection.h>
 #include <edm4hep/SimTrackerHitCollection.h>
 #include <spdlog/logger.h>
 #include <memory>
 
 #include "MatrixTransferStaticConfig.h"
+#include "algorithms/interfaces/CellIDGeometryCache.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -24,7 +24,7 @@ namespace eicrecon {
     double aYinv[2][2] = {{0.0, 0.0},
                           {0.0, 0.0}};
 
-    void init(const dd4hep::Detector* det, const dd4hep::rec::CellIDPositionConverter* id_conv, std::shared_ptr<spdlog::logger> &logger);
+    void init(const dd4hep::Detector* det, CellIDGeometryCache* cache, std::shared_ptr<spdlog::logger> &logger);
 
     std::unique_ptr<edm4eic::ReconstructedParticleCollection> produce(const edm4hep::SimTrackerHitCollection &inputhits);
 
@@ -33,7 +33,7 @@ namespace eicrecon {
     /** algorithm logger */
     std::shared_ptr<spdlog::logger>   m_log;
     const dd4hep::Detector* m_detector{nullptr};
-    const dd4hep::rec::CellIDPositionConverter* m_converter{nullptr};
+    CellIDGeometryCache* m_cache{nullptr};
 
   };
 }
@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <DD4hep/Alignments.h>
+#include <DD4hep/DetElement.h>
+#include <DD4hep/Detector.h>
+#include <DD4hep/IDDescriptor.h>
+#include <DD4hep/Objects.h>
+#include <DD4hep/Readout.h>
+#include <DD4hep/Segmentations.h>
+#include <DD4hep/Shapes.h>
+#include <DD4hep/VolumeManager.h>
+#include <DD4hep/Volumes.h>
+#include <DDRec/CellIDPositionConverter.h>
+#include <DDSegmentation/CartesianGridXY.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eicrecon {
+
+  /** Per-readout, per-volume and per-cell geometry lookups, computed once and shared between threads.
+   *
+   * Looking up the position, detector element, segmentation or dimensions of
+   * a cell goes through the DD4hep volume manager, which is expensive compared
+   * to the reconstruction of a single hit. Each quantity is computed on its
+   * first request, and is a single hash lookup afterwards.
+   * A lookup that throws (e.g. for an unknown cellID) is not cached, and the
+   * exception reaches the caller as for a direct DD4hep lookup.
+   *
+   * The segmentation belongs to the readout of a system. The detector element
+   * and bounding box belong to the placed volume, and are keyed on the volume
+   * ID, i.e. the cellID without the segmentation fields, so all cells of a
+   * volume share one entry. This needs the segmentation fields, which are known
+   * for CartesianGridXY (whose cells also share their dimensions) and
+   * NoSegmentation (one cell per volume); volumes of other segmentations are
+   * looked up without caching. Cell positions and other cell dimensions are
+   * kept in a per-cell table of bounded size, which is cleared when full;
+   * high-granularity readouts, whose cellIDs rarely repeat, should not use it,
+   * see position().
+   *
+   * The geometry is static, so entries are never invalidated. The tables are
+   * split in shards, each behind its own reader-writer lock, to limit
+   * contention between threads.
+   */
+  class CellIDGeometryCache {
+
+  public:
+    using CellID = std::uint64_t;
+
+    enum class SegmentationKind {
+      NoSegmentation,
+      CartesianGridXY,
+      Other,
+    };
+
+    /// Full widths of a cell along its local axes, unused axes are zero
+    using Dimensions = std::array<double, 3>;
+
+    CellIDGeometryCache(const dd4hep::Detector* detector, const dd4hep::rec::CellIDPositionConverter* converter)
+    : m_detector(detector), m_converter(converter), m_volman(detector->volumeManager()), m_systemMask(system_mask(detector)) {}
+
+    const dd4hep::Detector* detector() const { return m_detector; }
+    const dd4hep::rec::CellIDPositionConverter* converter() const { return m_converter; }
+
+    /// Global position of the cell center; cached per cell, so for readouts with
+    /// many more cells than hits per job use `converter()->position()` instead
+    dd4hep::Position position(CellID cellID) {
+      return getCell(cellID, &CellEntry::position, [&] { return m_converter->position(cellID); });
+    }
+
+    /// Detector element of the volume identified by cellID, which carries its local-to-global transform
+    dd4hep::DetElement detElement(CellID cellID) {
+      return getVolume(cellID, &VolumeEntry::element, [&] { return m_volman.lookupDetElement(cellID); });
+    }
+
+    /// Identifier of the placed volume of the cell, i.e. the cellID without the segmentation
+    /// fields; found from the cellID bits for known segmentations, else from the volume manager
+    CellID volumeID(CellID cellID) {
+      if (const CellID volume_mask = system(cellID).volumeMask; volume_mask != 0) {
+        return cellID & volume_mask;
+      }
+      return m_converter->findContext(cellID)->identifier;
+    }
+
+    /// Segmentation of the readout of the detector element of the cell
+    dd4hep::Segmentation segmentation(CellID cellID) {
+      return system(cellID).segmentation;
+    }
+
+    SegmentationKind segmentationKind(CellID cellID) {
+      return system(cellID).kind;
+    }
+
+    /// Cell dimensions as provided by the segmentation
+    Dimensions cellDimensions(CellID cellID) {
+      auto compute = [&] { return to_dimensions(m_converter->cellDimensions(cellID)); };
+      if (segmentationKind(cellID) == SegmentationKind::CartesianGridXY) {
+        // all cells of a grid have the same dimensions
+        return getVolume(cellID, &VolumeEntry::cellDimensions, compute);
+      }
+      return getCell(cellID, &CellEntry::cellDimensions, compute);
+    }
+
+    /// Full widths of the bounding box of the placed volume of the cell
+    Dimensions volumeDimensions(CellID cellID) {
+      return getVolume(cellID, &VolumeEntry::volumeDimensions, [&] {
+        auto dim = to_dimensions(m_volman.lookupContext(cellID)->volumePlacement().volume().boundingBox().dimensions());
+        for (auto& d : dim) {
+          d *= 2;
+        }
+        return dim;
+      });
+    }
+
+  private:
+    struct SystemEntry {
+      dd4hep::Segmentation segmentation;
+      SegmentationKind kind;
+      // cellID bits which identify the volume, or 0 if unknown
+      CellID volumeMask;
+    };
+
+    struct VolumeEntry {
+      std::optional<dd4hep::DetElement> element;
+      std::optional<Dimensions> cellDimensions;
+      std::optional<Dimensions> volumeDimensions;
+    };
+
+    struct CellEntry {
+      std::optional<dd4hep::Position> position;
+      std::optional<Dimensions> cellDimensions;
+    };
+
+    struct alignas(64) Shard {
+      std::shared_mutex mutex;
+      std::unordered_map<CellID, VolumeEntry> volumes;
+      std::unordered_map<CellID, CellEntry> cells;
+    };
+
+    static constexpr std::size_t kShards = 64;
+
+    // bound of the per-cell table
+    static constexpr std::size_t kMaxCellsPerShard = 4096;
+
+    static std::size_t shard_of(CellID cellID) {
+      // the low bits of a cellID are often constant within a detector, mix them first
+      cellID ^= cellID >> 33;
+      cellID *= 0xff51afd7ed558ccdULL;
+      cellID ^= cellID >> 33;
+      return cellID & (kShards - 1);
+    }
+
+    static Dimensions to_dimensions(const std::vector<double>& dim) {
+      Dimensions result{0., 0., 0.};
+      for (std::size_t i = 0; i < dim.size() && i < result.size(); ++i) {
+        result[i] = dim[i];
+      }
+      return result;
+    }
+
+    static CellID field_mask(const dd4hep::IDDescriptor& id_spec, const std::string& name) {
+      for (const auto& [field_name, field] : id_spec.fields()) {
+        if (field_name == name) {
+          return field->mask();
+        }
+      }
+      return 0;
+    }
+
+    // mask of the "system" field, which the volume manager requires in every readout
+    static CellID system_mask(const dd4hep::Detector* detector) {
+      for (const auto& [name, handle] : detector->readouts()) {
+        dd4hep::Readout readout(handle);
+        if (CellID mask = field_mask(readout.idSpec(), "system"); mask != 0) {
+          return mask;
+        }
+      }
+      return 0;
+    }
+
+    SystemEntry system(CellID cellID) {
+      const CellID system_id = cellID & m_systemMask;
+      {
+        std::shared_lock<std::shared_mutex> lock(m_systemsMutex);
+        auto it = m_systems.find(system_id);
+        if (it != m_systems.end()) {
+          return it->second;
+        }
+      }
+
+      auto readout = m_converter->findReadout(m_volman.lookupDetElement(cellID));
+      auto segmentation = readout.segmentation();
+      const std::string& type = segmentation.type();
+      SystemEntry entry{segmentation, SegmentationKind::Other, 0};
+      if (type == "CartesianGridXY") {
+        const auto* grid = dynamic_cast<const dd4hep::DDSegmentation::CartesianGridXY*>(segmentation.segmentation());
+        const CellID xy_mask = grid != nullptr
+          ? field_mask(readout.idSpec(), grid->fieldNameX()) | field_mask(readout.idSpec(), grid->fieldNameY())
+          : 0;
+        entry.kind = SegmentationKind::CartesianGridXY;
+        entry.volumeMask = xy_mask != 0 ? ~xy_mask : 0;
+      } else if (type == "NoSegmentation") {
+        entry.kind = SegmentationKind::NoSegmentation;
+        entry.volumeMask = ~CellID{0};
+      }
+
+      std::unique_lock<std::shared_mutex> lock(m_systemsMutex);
+      return m_systems.try_emplace(system_id, entry).first->second;
+    }
+
+    template<typename T, typename Compute>
+    T getVolume(CellID cellID, std::optional<T> VolumeEntry::* field, Compute&& compute) {
+      const CellID volume_mask = system(cellID).volumeMask;
+      if (volume_mask == 0) {
+        return compute();
+      }
+      const CellID volumeID = cellID & volume_mask;
+      Shard& shard = m_shards[shard_of(volumeID)];
+      {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.volumes.find(volumeID);
+        if (it != shard.volumes.end() && (it->second.*field).has_value()) {
+          return *(it->second.*field);
+        }
+      }
+
+      // computed without holding the lock, another thread may race us to the same value
+      T value = compute();
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      auto& slot = shard.volumes[volumeID].*field;
+      if (!slot.has_value()) {
+        slot = std::move(value);
+      }
+      return *slot;
+    }
+
+    template<typename T, typename Compute>
+    T getCell(CellID cellID, std::optional<T> CellEntry::* field, Compute&& compute) {
+      Shard& shard = m_shards[shard_of(cellID)];
+      {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.cells.find(cellID);
+        if (it != shard.cells.end() && (it->second.*field).has_value()) {
+          return *(it->second.*field);
+        }
+      }
+
+      // computed without holding the lock, another thread may race us to the same value
+      T value = compute();
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      if (shard.cells.size() >= kMaxCellsPerShard && shard.cells.find(cellID) == shard.cells.end()) {
+        shard.cells.clear();
+      }
+      auto& slot = shard.cells[cellID].*field;
+      if (!slot.has_value()) {
+        slot = std::move(value);
+      }
+      return *slot;
+    }
+
+    const dd4hep::Detector* m_detector;
+    const dd4hep::rec::CellIDPositionConverter* m_converter;
+    dd4hep::VolumeManager m_volman;
+
+    CellID m_systemMask;
+    std::shared_mutex m_systemsMutex;
+    std::unordered_map<CellID, SystemEntry> m_systems;
+
+    std::array<Shard, kShards> m_shards;
+  };
+
+} // namespace eicrecon
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eicrecon {
+
+  /** Threads which are started once, and share the tasks of each call to run().
+   *
+   * An algorithm which splits the work of one event between threads owns a pool,
+   * instead of starting and joining threads for every event. The calling thread
+   * works as well, as thread 0, so a pool of one thread runs everything serially
+   * and starts no threads. Each thread takes the next task until none are left,
+   * so the assignment of tasks to threads varies between calls; the task must not
+   * depend on it other than through the thread index, e.g. to pick its scratch space.
+   *
+   * run() is not reentrant and must not be called from several threads at once,
+   * which holds for a pool owned by an algorithm instance, since JANA2 gives each
+   * event thread its own factories.
+   */
+  class WorkerPool {
+
+  public:
+    /// `task(i_thread, i_task)`, with `i_thread` in [0, size())
+    using Task = std::function<void(std::size_t, std::size_t)>;
+
+    explicit WorkerPool(std::size_t num_threads = 1) { resize(num_threads); }
+    ~WorkerPool() { stop(); }
+
+    WorkerPool(const WorkerPool&)            = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// Number of threads, including the calling thread
+    std::size_t size() const { return m_threads.size() + 1; }
+
+    /// Stops the threads, and starts `num_threads - 1` new ones
+    void resize(std::size_t num_threads) {
+      stop();
+      m_stop = false;
+      for(std::size_t i_thread = 1; i_thread < num_threads; i_thread++)
+        m_threads.emplace_back(&WorkerPool::loop, this, i_thread, m_generation);
+    }
+
+    /** Runs `task` for each task index in [0, num_tasks), and returns when all are done.
+     *
+     * Exceptions are caught in the threads; the one of the first failing task (in task
+     * order) is rethrown here, after all tasks have run.
+     */
+    void run(std::size_t num_tasks, const Task& task) {
+      if(m_threads.empty() || num_tasks <= 1) {
+        for(std::size_t i_task = 0; i_task < num_tasks; i_task++)
+          task(0, i_task);
+        return;
+      }
+
+      m_errors.assign(num_tasks, nullptr);
+      m_next_task = 0;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task      = &task;
+        m_num_tasks = num_tasks;
+        m_busy      = m_threads.size();
+        m_generation++;
+      }
+      m_start.notify_all();
+
+      work(0);
+
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_busy == 0; });
+        m_task = nullptr;
+      }
+
+      for(auto& error : m_errors)
+        if(error)
+          std::rethrow_exception(error);
+    }
+
+  private:
+    std::vector<std::thread> m_threads;
+
+    std::mutex              m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_done;
+    bool                    m_stop       = false;
+    std::uint64_t           m_generation = 0; // number of calls to run() with threads, wakes up the threads
+    std::size_t             m_busy       = 0; // threads which have not finished the current call
+
+    // current call; set under the lock before the threads are woken up
+    const Task*                     m_task      = nullptr;
+    std::size_t                     m_num_tasks = 0;
+    std::atomic<std::size_t>        m_next_task{0};
+    std::vector<std::exception_ptr> m_errors;
+
+    void work(std::size_t i_thread) {
+      for(auto i_task = m_next_task++; i_task < m_num_tasks; i_task = m_next_task++) {
+        try {
+          (*m_task)(i_thread, i_task);
+        }
+        catch(...) {
+          m_errors[i_task] = std::current_exception();
+        }
+      }
+    }
+
+    void loop(std::size_t i_thread, std::uint64_t generation) {
+      for(;;) {
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_start.wait(lock, [&] { return m_stop || m_generation != generation; });
+          if(m_stop)
+            return;
+          generation = m_generation;
+        }
+        work(i_thread);
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          m_busy--;
+        }
+        m_done.notify_one();
+      }
+    }
+
+    void stop() {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+      }
+      m_start.notify_all();
+      for(auto& thread : m_threads)
+        thread.join();
+      m_threads.clear();
+    }
+  };
+
+}
@@ -0,0 +1,115 @@
+// Copyright 2023, Christopher Dilks
+// Subject to the terms in the LICENSE file found in the top-level directory.
+
+#include "CherenkovSensorIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Build
+//---------------------------------------------------------------------------
+std::size_t eicrecon::CherenkovSensorIndex::Build(const CherenkovSensorGeometry& geometry) {
+
+  m_sensors.clear();
+  m_bin_offsets.assign(m_num_theta_bins * m_num_phi_bins + 1, 0);
+  m_max_half_angle = 0.0;
+
+  // map each sensor to the direction of the photons which its sector's mirror focuses on it
+  std::vector<IndexedSensor> sensors;
+  for(const auto& [sensor_id, sensor] : geometry.sensors) {
+    auto mirror_it = geometry.mirror_centers.find(sensor.sector);
+    if(mirror_it == geometry.mirror_centers.end())
+      continue;
+    auto to_sensor = sensor.position - mirror_it->second;
+    auto dist      = to_sensor.Mag();
+    if(dist <= 0)
+      continue;
+    auto half_angle = std::atan(sensor.size / std::sqrt(2.0) / dist);
+    sensors.push_back({ sensor_id, to_sensor.Unit(), half_angle });
+    m_max_half_angle = std::max(m_max_half_angle, half_angle);
+  }
+  if(sensors.empty())
+    return 0;
+
+  // theta binning covers the sensors' directions only
+  auto [min_it, max_it] = std::minmax_element(sensors.begin(), sensors.end(),
+      [](const auto& a, const auto& b) { return a.direction.Theta() < b.direction.Theta(); });
+  m_theta_min   = min_it->direction.Theta();
+  m_theta_width = std::max((max_it->direction.Theta() - m_theta_min) / m_num_theta_bins, 1e-6);
+
+  // counting sort of the sensors into their bins
+  auto bin_of = [this](const IndexedSensor& s) {
+    return ThetaBin(s.direction.Theta()) * m_num_phi_bins + PhiBin(s.direction.Phi());
+  };
+  for(const auto& s : sensors)
+    ++m_bin_offsets[bin_of(s) + 1];
+  for(std::size_t b = 1; b < m_bin_offsets.size(); b++)
+    m_bin_offsets[b] += m_bin_offsets[b-1];
+  m_sensors.resize(sensors.size());
+  auto fill = m_bin_offsets;
+  for(const auto& s : sensors)
+    m_sensors[fill[bin_of(s)]++] = s;
+
+  return m_sensors.size();
+}
+
+
+// FindReachableSensors
+//---------------------------------------------------------------------------
+void eicrecon::CherenkovSensorIndex::FindReachableSensors(
+    const TVector3&        direction,
+    double                 max_angle,
+    std::vector<uint64_t>& sensor_ids
+    ) const
+{
+  sensor_ids.clear();
+  if(m_sensors.empty() || direction.Mag2() <= 0)
+    return;
+
+  auto dir   = direction.Unit();
+  auto theta = dir.Theta();
+  auto phi   = dir.Phi();
+
+  // theta bins overlapping the cone, widened by the largest sensor size
+  auto reach = max_angle + m_max_half_angle;
+  auto theta_lo = theta - reach;
+  auto theta_hi = theta + reach;
+  if(theta_hi < m_theta_min || theta_lo > m_theta_min + m_num_theta_bins * m_theta_width)
+    return;
+  int theta_bin_lo = ThetaBin(theta_lo);
+  int theta_bin_hi = ThetaBin(theta_hi);
+
+  // phi bins overlapping the cone; a cone around the pole covers all of them
+  int phi_bin_lo = 0;
+  int num_phi    = m_num_phi_bins;
+  if(theta_lo > 0 && theta_hi < M_PI && std::sin(reach) < std::sin(theta)) {
+    auto dphi  = std::asin(std::sin(reach) / std::sin(theta));
+    phi_bin_lo = PhiBin(phi - dphi);
+    num_phi    = std::min(m_num_phi_bins, (PhiBin(phi + dphi) - phi_bin_lo + m_num_phi_bins) % m_num_phi_bins + 1);
+  }
+
+  // check each candidate sensor, allowing for its size
+  for(int theta_bin = theta_bin_lo; theta_bin <= theta_bin_hi; theta_bin++) {
+    for(int i = 0; i < num_phi; i++) {
+      int bin = theta_bin * m_num_phi_bins + (phi_bin_lo + i) % m_num_phi_bins;
+      for(auto s = m_bin_offsets[bin]; s < m_bin_offsets[bin+1]; s++) {
+        const auto& sensor = m_sensors[s];
+        if(dir.Dot(sensor.direction) >= std::cos(std::min(M_PI, max_angle + sensor.half_angle)))
+          sensor_ids.push_back(sensor.id);
+      }
+    }
+  }
+}
+
+
+// binning
+//---------------------------------------------------------------------------
+int eicrecon::CherenkovSensorIndex::ThetaBin(double theta) const {
+  auto bin = static_cast<int>(std::floor((theta - m_theta_min) / m_theta_width));
+  return std::clamp(bin, 0, m_num_theta_bins - 1);
+}
+
+int eicrecon::CherenkovSensorIndex::PhiBin(double phi) const {
+  auto bin = static_cast<int>(std::floor((phi + M_PI) / (2 * M_PI) * m_num_phi_bins));
+  return ((bin % m_num_phi_bins) + m_num_phi_bins) % m_num_phi_bins;
+}
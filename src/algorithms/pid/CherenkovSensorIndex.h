@@ -0,0 +1,74 @@
+// Copyright 2023, Christopher Dilks
+// Subject to the terms in the LICENSE file found in the top-level directory.
+//
+// Spatial index of RICH sensors, to find which sensors a track's Cherenkov photons can reach
+//
+
+#pragma once
+
+#include <TVector3.h>
+#include <stdint.h>
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace eicrecon {
+
+  // sensor geometry, as needed by `CherenkovSensorIndex`; all positions in [mm]
+  struct CherenkovSensorGeometry {
+    struct Sensor {
+      int      sector;
+      TVector3 position; // sensor surface centroid
+      double   size;     // sensor side length
+    };
+    std::unordered_map<uint64_t,Sensor> sensors;        // sensor ID -> sensor
+    std::map<int,TVector3>              mirror_centers; // sector -> center of curvature of its focusing mirror
+  };
+
+  /* For a spherical mirror, all photons with the same direction are focused to one point,
+   * about halfway between the mirror and its center of curvature. Each sensor is therefore
+   * mapped to the photon direction which is focused on it, and binned in (theta,phi) of that
+   * direction. A track emits its Cherenkov photons within a cone around its direction, so only
+   * the sensors in the bins overlapping this cone need to be checked.
+   *
+   * Sensors in sectors without a focusing mirror (e.g., proximity focusing) cannot be indexed;
+   * if there are no indexed sensors, the index is disabled and the caller should use all sensors.
+   */
+  class CherenkovSensorIndex {
+    public:
+
+      CherenkovSensorIndex() = default;
+      ~CherenkovSensorIndex() {}
+
+      // build the index; returns the number of indexed sensors
+      std::size_t Build(const CherenkovSensorGeometry& geometry);
+
+      // true if any sensors are indexed
+      bool Enabled() const { return !m_sensors.empty(); }
+
+      // fill `sensor_ids` with all sensors which photons emitted within `max_angle` of `direction` can reach
+      void FindReachableSensors(const TVector3& direction, double max_angle, std::vector<uint64_t>& sensor_ids) const;
+
+    private:
+
+      struct IndexedSensor {
+        uint64_t id;
+        TVector3 direction;  // unit direction of photons focused on this sensor
+        double   half_angle; // angular half-diagonal of the sensor, as seen from the mirror center
+      };
+
+      static constexpr int m_num_theta_bins = 32;
+      static constexpr int m_num_phi_bins   = 64;
+
+      int ThetaBin(double theta) const;
+      int PhiBin(double phi) const;
+
+      std::vector<IndexedSensor>   m_sensors;
+      std::vector<std::size_t>     m_bin_offsets; // sensors in bin `b` are `m_sensors[m_bin_offsets[b]]` to `m_sensors[m_bin_offsets[b+1]-1]`
+      double                       m_theta_min      = 0.0;
+      double                       m_theta_width    = 0.0;
+      double                       m_max_half_angle = 0.0;
+
+  };
+}
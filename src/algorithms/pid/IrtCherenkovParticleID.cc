@@ -20,9 +20,8 @@
 #include <podio/RelationRange.h>
 #include <spdlog/common.h>
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
-#include <exception>
-#include <functional>
 #include <iterator>
 #include <set>
 #include <stdexcept>
@@ -35,13 +34,13 @@
 // AlgorithmInit
 //---------------------------------------------------------------------------
 void eicrecon::IrtCherenkovParticleID::AlgorithmInit(
-    CherenkovDetectorCollection*     irt_det_coll,
-    std::shared_ptr<spdlog::logger>& logger
+    const std::vector<CherenkovDetectorCollection*>& irt_det_colls,
+    const CherenkovSensorGeometry&                    sensor_geometry,
+    std::shared_ptr<spdlog::logger>&                 logger
     )
 {
   // members
-  m_irt_det_coll = irt_det_coll;
-  m_log          = logger;
+  m_log = logger;
 
   // print the configuration parameters
   m_cfg.Print(m_log, spdlog::level::debug);
@@ -49,24 +48,88 @@ void eicrecon::IrtCherenkovParticleID::AlgorithmInit(
   // inform the user if a cheat mode is enabled
   m_cfg.PrintCheats(m_log);
 
-  // extract the the relevant `CherenkovDetector`, set to `m_irt_det`
-  auto& detectors = m_irt_det_coll->GetDetectors();
+  // set up the workers; only the first one logs at debug level
+  // - each worker has its own IRT geometry, whose radiators hold the state of its charged particle,
+  //   and its own photons; the other inputs of `ProcessParticle` are only read
+  // - IRT smears the photon angles with ROOT's global `gRandom`, which is not thread safe, so
+  //   with smearing the charged particles are processed serially, by the first worker
+  if(irt_det_colls.empty())
+    throw std::runtime_error("No IRT geometry given to IrtCherenkovParticleID");
+  auto num_workers = irt_det_colls.size();
+  if(num_workers > 1) {
+    for(const auto& [rad_name,cfg_rad] : m_cfg.radiators) {
+      if(cfg_rad.smearing > 0) {
+        m_log->warn("Smearing of the {} radiator uses ROOT's gRandom, which is not thread safe; using 1 thread instead of {}", rad_name, num_workers);
+        num_workers = 1;
+        break;
+      }
+    }
+  }
+  m_workers.clear();
+  for(std::size_t i_worker = 0; i_worker < num_workers; i_worker++)
+    m_workers.push_back(InitWorker(irt_det_colls[i_worker], m_workers.empty() ? spdlog::level::debug : spdlog::level::trace));
+  m_pool.resize(m_workers.size());
+  m_log->debug("IrtCherenkovParticleID has {} worker(s)", m_workers.size());
+  const auto& worker = m_workers.front();
+  m_det_name  = worker.irt_det_coll->GetDetectors().begin()->first;
+  m_cell_mask = worker.irt_det->GetReadoutCellMask();
+
+  // fiducial preselection: index the sensors, and find each radiator's maximum Cherenkov angle,
+  // i.e., for the largest refractive index and beta=1
+  if(m_cfg.fiducialPreselection) {
+    auto num_indexed = m_sensor_index.Build(sensor_geometry);
+    m_log->debug("Fiducial preselection: indexed {} of {} sensors", num_indexed, sensor_geometry.sensors.size());
+    if(!m_sensor_index.Enabled())
+      m_log->warn("No sensors could be indexed for the fiducial preselection; all hits will be used for each track");
+    for(auto [rad_name,irt_rad] : worker.pid_radiators) {
+      double rindex_max = irt_rad->m_AverageRefractiveIndex;
+      for(auto [energy,rindex] : irt_rad->m_ri_lookup_table)
+        rindex_max = std::max(rindex_max, rindex);
+      auto max_angle = rindex_max > 1.0 ? std::acos(1.0 / rindex_max) : 0.0;
+      m_max_cherenkov_angle.insert({ rad_name, max_angle });
+      m_log->debug("  {} radiator: max. Cherenkov angle = {} rad", rad_name, max_angle);
+    }
+  }
+
+  // get PDG info for the particles we want to identify in PID
+  // FIXME: cannot use `TDatabasePDG` since it is not thread safe; until we
+  // have a proper PDG database service, we hard-code the masses in Tools.h
+  m_log->debug("List of particles for PID:");
+  for(auto pdg : m_cfg.pdgList) {
+    auto mass = Tools::GetPDGMass(pdg);
+    m_pdg_mass.insert({ pdg, mass });
+    m_log->debug("  {:>8}  M={} GeV", pdg, mass);
+  }
+
+}
+
+
+// InitWorker
+//---------------------------------------------------------------------------
+eicrecon::IrtCherenkovParticleID::Worker eicrecon::IrtCherenkovParticleID::InitWorker(
+    CherenkovDetectorCollection* irt_det_coll,
+    spdlog::level::level_enum    lvl
+    )
+{
+  Worker worker;
+  worker.irt_det_coll = irt_det_coll;
+
+  // extract the the relevant `CherenkovDetector`, set to `worker.irt_det`
+  auto& detectors = irt_det_coll->GetDetectors();
   if(detectors.size() == 0)
     throw std::runtime_error("No CherenkovDetectors found in input collection `irt_det_coll`");
   if(detectors.size() > 1)
     m_log->warn("IrtCherenkovParticleID currently only supports 1 CherenkovDetector at a time; taking the first");
   auto this_detector = *detectors.begin();
-  m_det_name         = this_detector.first;
-  m_irt_det          = this_detector.second;
-  m_log->debug("Initializing IrtCherenkovParticleID algorithm for CherenkovDetector '{}'", m_det_name);
+  worker.irt_det     = this_detector.second;
+  m_log->log(lvl, "Initializing IrtCherenkovParticleID algorithm for CherenkovDetector '{}'", this_detector.first);
 
   // readout decoding
-  m_cell_mask = m_irt_det->GetReadoutCellMask();
-  m_log->debug("readout cellMask = {:#X}", m_cell_mask);
+  m_log->log(lvl, "readout cellMask = {:#X}", worker.irt_det->GetReadoutCellMask());
 
   // rebin refractive index tables to have `m_cfg.numRIndexBins` bins
   m_log->trace("Rebinning refractive index tables to have {} bins",m_cfg.numRIndexBins);
-  for(auto [rad_name,irt_rad] : m_irt_det->Radiators()) {
+  for(auto [rad_name,irt_rad] : worker.irt_det->Radiators()) {
     auto ri_lookup_table_orig = irt_rad->m_ri_lookup_table;
     irt_rad->m_ri_lookup_table.clear();
     irt_rad->m_ri_lookup_table = Tools::ApplyFineBinning( ri_lookup_table_orig, m_cfg.numRIndexBins );
@@ -74,17 +137,17 @@ void eicrecon::IrtCherenkovParticleID::AlgorithmInit(
     // for(auto [energy,rindex] : irt_rad->m_ri_lookup_table) m_log->trace("  {:>5} eV   {:<}", energy, rindex);
   }
 
-  // build `m_pid_radiators`, the list of radiators to use for PID
-  m_log->debug("Obtain List of Radiators:");
-  for(auto [rad_name,irt_rad] : m_irt_det->Radiators()) {
+  // build `worker.pid_radiators`, the list of radiators to use for PID
+  m_log->log(lvl, "Obtain List of Radiators:");
+  for(auto [rad_name,irt_rad] : worker.irt_det->Radiators()) {
     if(rad_name!="Filter") {
-      m_pid_radiators.insert({ std::string(rad_name), irt_rad });
-      m_log->debug("- {}", rad_name.Data());
+      worker.pid_radiators.insert({ std::string(rad_name), irt_rad });
+      m_log->log(lvl, "- {}", rad_name.Data());
     }
   }
 
-  // check radiators' configuration, and pass it to `m_irt_det`'s radiators
-  for(auto [rad_name,irt_rad] : m_pid_radiators) {
+  // check radiators' configuration, and pass it to `worker.irt_det`'s radiators
+  for(auto [rad_name,irt_rad] : worker.pid_radiators) {
     // find `cfg_rad`, the associated `IrtCherenkovParticleIDConfig` radiator
     auto cfg_rad_it = m_cfg.radiators.find(rad_name);
     if(cfg_rad_it != m_cfg.radiators.end()) {
@@ -108,16 +171,7 @@ void eicrecon::IrtCherenkovParticleID::AlgorithmInit(
       m_log->error("Cannot find radiator '{}' in IrtCherenkovParticleIDConfig instance", rad_name);
   }
 
-  // get PDG info for the particles we want to identify in PID
-  // FIXME: cannot use `TDatabasePDG` since it is not thread safe; until we
-  // have a proper PDG database service, we hard-code the masses in Tools.h
-  m_log->debug("List of particles for PID:");
-  for(auto pdg : m_cfg.pdgList) {
-    auto mass = Tools::GetPDGMass(pdg);
-    m_pdg_mass.insert({ pdg, mass });
-    m_log->debug("  {:>8}  M={} GeV", pdg, mass);
-  }
-
+  return worker;
 }
 
 
@@ -142,7 +196,7 @@ std::map<std::string, std::unique_ptr<edm4eic::CherenkovParticleIDCollection>> e
 
   // start output collections
   std::map<std::string, std::unique_ptr<edm4eic::CherenkovParticleIDCollection>> result;
-  for(auto [rad_name,irt_rad] : m_pid_radiators)
+  for(auto [rad_name,irt_rad] : m_workers.front().pid_radiators)
     result.insert({rad_name, std::make_unique<edm4eic::CherenkovParticleIDCollection>()});
 
   // check `in_charged_particles`: each radiator should have the same number of TrackSegments
@@ -159,279 +213,393 @@ std::map<std::string, std::unique_ptr<edm4eic::CherenkovParticleIDCollection>> e
     return result;
   }
 
-  // loop over charged particles ********************************************
+  // group raw hits by sensor, for the fiducial preselection
+  m_sensor_hits.clear();
+  if(m_cfg.fiducialPreselection && m_sensor_index.Enabled()) {
+    m_sensor_hits.reserve(in_raw_hits->size());
+    for(std::size_t i_raw_hit = 0; i_raw_hit < in_raw_hits->size(); i_raw_hit++)
+      m_sensor_hits.emplace_back((*in_raw_hits)[i_raw_hit].getCellID() & m_cell_mask, i_raw_hit);
+    std::sort(m_sensor_hits.begin(), m_sensor_hits.end());
+  }
+
+  // index the MC associations by raw hit; the first association of each raw hit is used
+  m_hit_assoc_index.clear();
+  m_hit_assoc_index.reserve(in_hit_assocs->size());
+  for(std::size_t i_hit_assoc = 0; i_hit_assoc < in_hit_assocs->size(); i_hit_assoc++) {
+    auto assoc_raw_hit = (*in_hit_assocs)[i_hit_assoc].getRawHit();
+    if(assoc_raw_hit.isAvailable())
+      m_hit_assoc_index.emplace(ObjectKey(assoc_raw_hit.id()), i_hit_assoc);
+  }
+
+  // run IRT for each charged particle ****************************************
+  /* charged particles are independent; the threads of `m_pool` take the next particle until
+   * none are left, each with its own worker; the results are filled into the output collections
+   * in particle order, so the output does not depend on the number of workers
+   */
   m_log->trace("{:#<70}","### CHARGED PARTICLES ");
   std::size_t num_charged_particles = in_charged_particle_size_distribution.begin()->first;
-  for(long i_charged_particle=0; i_charged_particle<num_charged_particles; i_charged_particle++) {
-    m_log->trace("{:-<70}", fmt::format("--- charged particle #{} ", i_charged_particle));
+  std::vector<ParticleResult> particle_results(num_charged_particles);
+  m_pool.run(num_charged_particles, [&] (std::size_t i_worker, std::size_t i_charged_particle) {
+    particle_results[i_charged_particle] = ProcessParticle(m_workers[i_worker], i_charged_particle, in_charged_particles, in_raw_hits, in_hit_assocs);
+  });
 
-    // start an `irt_particle`, for `IRT`
-    auto irt_particle = std::make_unique<ChargedParticle>();
+  // fill the output collections ********************************************
+  for(std::size_t i_charged_particle=0; i_charged_particle<num_charged_particles; i_charged_particle++) {
+    for(const auto& rad_result : particle_results[i_charged_particle]) {
+
+      // fill photon info
+      auto out_cherenkov_pid = result.at(rad_result.rad_name)->create();
+      out_cherenkov_pid.setNpe(static_cast<decltype(edm4eic::CherenkovParticleIDData::npe)>(rad_result.npe));
+      out_cherenkov_pid.setRefractiveIndex(static_cast<decltype(edm4eic::CherenkovParticleIDData::refractiveIndex)>(rad_result.rindex_ave));
+      out_cherenkov_pid.setPhotonEnergy(static_cast<decltype(edm4eic::CherenkovParticleIDData::photonEnergy)>(rad_result.energy_ave));
+      for(auto [phot_theta,phot_phi] : rad_result.theta_phi)
+        out_cherenkov_pid.addToThetaPhiPhotons(edm4hep::Vector2f{
+            static_cast<float>(phot_theta),
+            static_cast<float>(phot_phi)
+            });
 
-    // loop over radiators
-    for(auto [rad_name,irt_rad] : m_pid_radiators) {
+      // relate mass hypotheses
+      for(const auto& out_hypothesis : rad_result.hypotheses)
+        out_cherenkov_pid.addToHypotheses(out_hypothesis);
 
-      // get the `charged_particle` for this radiator
-      auto charged_particle_list_it = in_charged_particles.find(rad_name);
-      if(charged_particle_list_it == in_charged_particles.end()) {
-        m_log->error("Cannot find radiator '{}' in `in_charged_particles`", rad_name);
-        continue;
-      }
-      const auto *charged_particle_list = charged_particle_list_it->second;
-      auto charged_particle      = charged_particle_list->at(i_charged_particle);
+      // logging
+      Tools::PrintCherenkovEstimate(m_log, out_cherenkov_pid);
 
-      // set number of bins for this radiator and charged particle
-      if(charged_particle.points_size()==0) {
-        m_log->trace("No propagated track points in radiator '{}'", rad_name);
-        continue;
-      }
-      irt_rad->SetTrajectoryBinCount(charged_particle.points_size() - 1);
-
-      // start a new IRT `RadiatorHistory`
-      // - must be a raw pointer for `irt` compatibility
-      // - it will be destroyed when `irt_particle` is destroyed
-      auto *irt_rad_history = new RadiatorHistory();
-      irt_particle->StartRadiatorHistory({ irt_rad, irt_rad_history });
-
-      // loop over `TrackPoint`s of this `charged_particle`, adding each to the IRT radiator
-      irt_rad->ResetLocations();
-      m_log->trace("TrackPoints in '{}' radiator:", rad_name);
-      for(const auto& point : charged_particle.getPoints()) {
-        TVector3 position = Tools::PodioVector3_to_TVector3(point.position);
-        TVector3 momentum = Tools::PodioVector3_to_TVector3(point.momentum);
-        irt_rad->AddLocation(position, momentum);
-        Tools::PrintTVector3(m_log, " point: x", position);
-        Tools::PrintTVector3(m_log, "        p", momentum);
+      // relate charged particle projection
+      auto charged_particle_list_it = in_charged_particles.find("Merged");
+      if(charged_particle_list_it != in_charged_particles.end()) {
+        const auto *charged_particle_list = charged_particle_list_it->second;
+        auto charged_particle      = charged_particle_list->at(i_charged_particle);
+        out_cherenkov_pid.setChargedParticle(charged_particle);
       }
+      else
+        m_log->error("Cannot find radiator 'Merged' in `in_charged_particles`");
 
+      // relate hit associations of the photons used for this estimate
+      for(auto i_hit_assoc : rad_result.hit_assocs)
+        out_cherenkov_pid.addToRawHitAssociations((*in_hit_assocs)[i_hit_assoc]);
 
-      // loop over raw hits ***************************************************
-      m_log->trace("{:#<70}","### SENSOR HITS ");
-      for(const auto& raw_hit : *in_raw_hits) {
-
-        // get MC photon(s), typically only used by cheat modes or trace logging
-        // - loop over `in_hit_assocs`, searching for the matching hit association
-        // - will not exist for noise hits
-        edm4hep::MCParticle mc_photon;
-        bool mc_photon_found = false;
-        if(m_cfg.cheatPhotonVertex || m_cfg.cheatTrueRadiator) {
-          for(const auto& hit_assoc : *in_hit_assocs) {
-            if(hit_assoc.getRawHit().isAvailable()) {
-              if(hit_assoc.getRawHit().id() == raw_hit.id()) {
-                // hit association found, get the MC photon and break the loop
-                // FIXME: occasionally there will be more than one photon associated with a hit;
-                // for now let's just take the first one...
-                if(hit_assoc.simHits_size() > 0) {
-                  mc_photon = hit_assoc.getSimHits(0).getMCParticle();
-                  mc_photon_found = true;
-                  if(mc_photon.getPDG() != -22)
-                    m_log->warn("non-opticalphoton hit: PDG = {}",mc_photon.getPDG());
-                }
-                else if(m_cfg.CheatModeEnabled())
-                  m_log->error("cheat mode enabled, but no MC photons provided");
-                break;
-              }
-            }
-          }
-        }
+    } // end radiator loop
+  } // end `in_charged_particles` loop
+
+  for(std::size_t i_worker = 0; i_worker < m_workers.size(); i_worker++)
+    m_log->debug("IRT photon pool of worker {}: {} photons used so far, {} allocated",
+        i_worker, m_workers[i_worker].photon_pool.Acquired(), m_workers[i_worker].photon_pool.Allocations());
+
+  return result;
+}
 
-        // cheat mode, for testing only: use MC photon to get the actual radiator
-        if(m_cfg.cheatTrueRadiator && mc_photon_found) {
-          auto vtx    = Tools::PodioVector3_to_TVector3(mc_photon.getVertex());
-          auto mc_rad = m_irt_det->GuessRadiator(vtx, vtx); // assume IP is at (0,0,0)
-          if(mc_rad != irt_rad) continue; // skip this photon, if not from radiator `irt_rad`
-          Tools::PrintTVector3(m_log, fmt::format("cheat: radiator '{}' determined from photon vertex", rad_name), vtx);
-        }
 
-        // get sensor and pixel info
-        // FIXME: signal and timing cuts (ADC, TDC, ToT, ...)
-        auto     cell_id   = raw_hit.getCellID();
-        uint64_t sensor_id = cell_id & m_cell_mask;
-        TVector3 pixel_pos = m_irt_det->m_ReadoutIDToPosition(cell_id);
-
-        // trace logging
-        if(m_log->level() <= spdlog::level::trace) {
-          m_log->trace("cell_id={:#X}  sensor_id={:#X}", cell_id, sensor_id);
-          Tools::PrintTVector3(m_log, "pixel position", pixel_pos);
-          if(mc_photon_found) {
-            TVector3 mc_endpoint = Tools::PodioVector3_to_TVector3(mc_photon.getEndpoint());
-            Tools::PrintTVector3(m_log, "photon endpoint", mc_endpoint);
-            m_log->trace("{:>30} = {}", "dist( pixel,  photon )", (pixel_pos  - mc_endpoint).Mag());
-          }
-          else m_log->trace("  no MC photon found; probably a noise hit");
+// ProcessParticle
+//---------------------------------------------------------------------------
+eicrecon::IrtCherenkovParticleID::ParticleResult eicrecon::IrtCherenkovParticleID::ProcessParticle(
+    Worker&                                                        worker,
+    std::size_t                                                    i_charged_particle,
+    std::map<std::string, const edm4eic::TrackSegmentCollection*>& in_charged_particles,
+    const edm4eic::RawTrackerHitCollection*                        in_raw_hits,
+    const edm4eic::MCRecoTrackerHitAssociationCollection*          in_hit_assocs
+    )
+{
+  m_log->trace("{:-<70}", fmt::format("--- charged particle #{} ", i_charged_particle));
+  ParticleResult particle_result;
+
+  // start an `irt_particle`, for `IRT`
+  // - its photons are taken from `worker.photon_pool`, which owns them; they must be detached
+  //   from the radiator histories before `irt_particle` is destroyed, since IRT deletes them
+  auto release_photons = [&worker] (ChargedParticle* particle) {
+    for(auto [rad_name,irt_rad] : worker.pid_radiators) {
+      auto *irt_rad_history = particle->FindRadiatorHistory(irt_rad);
+      if(irt_rad_history != nullptr)
+        irt_rad_history->Photons().clear();
+    }
+    delete particle;
+  };
+  std::unique_ptr<ChargedParticle, decltype(release_photons)> irt_particle(new ChargedParticle(), release_photons);
+  worker.photon_pool.Reset();
+
+  // loop over radiators
+  for(auto [rad_name,irt_rad] : worker.pid_radiators) {
+
+    // get the `charged_particle` for this radiator
+    auto charged_particle_list_it = in_charged_particles.find(rad_name);
+    if(charged_particle_list_it == in_charged_particles.end()) {
+      m_log->error("Cannot find radiator '{}' in `in_charged_particles`", rad_name);
+      continue;
+    }
+    const auto *charged_particle_list = charged_particle_list_it->second;
+    auto charged_particle      = charged_particle_list->at(i_charged_particle);
+
+    // set number of bins for this radiator and charged particle
+    if(charged_particle.points_size()==0) {
+      m_log->trace("No propagated track points in radiator '{}'", rad_name);
+      continue;
+    }
+    irt_rad->SetTrajectoryBinCount(charged_particle.points_size() - 1);
+
+    // start a new IRT `RadiatorHistory`
+    // - must be a raw pointer for `irt` compatibility
+    // - it will be destroyed when `irt_particle` is destroyed
+    auto *irt_rad_history = new RadiatorHistory();
+    irt_particle->StartRadiatorHistory({ irt_rad, irt_rad_history });
+    auto& photon_hit_assocs = worker.photon_hit_assocs[rad_name];
+    photon_hit_assocs.clear();
+
+    // loop over `TrackPoint`s of this `charged_particle`, adding each to the IRT radiator
+    irt_rad->ResetLocations();
+    m_log->trace("TrackPoints in '{}' radiator:", rad_name);
+    for(const auto& point : charged_particle.getPoints()) {
+      TVector3 position = Tools::PodioVector3_to_TVector3(point.position);
+      TVector3 momentum = Tools::PodioVector3_to_TVector3(point.momentum);
+      irt_rad->AddLocation(position, momentum);
+      Tools::PrintTVector3(m_log, " point: x", position);
+      Tools::PrintTVector3(m_log, "        p", momentum);
+    }
+
+
+    // loop over raw hits ***************************************************
+    m_log->trace("{:#<70}","### SENSOR HITS ");
+    SelectHits(worker, charged_particle, rad_name, in_raw_hits->size());
+    m_log->trace("{} of {} raw hits are on sensors reachable from '{}' radiator", worker.selected_hits.size(), in_raw_hits->size(), rad_name);
+    for(auto i_raw_hit : worker.selected_hits) {
+      auto raw_hit = (*in_raw_hits)[i_raw_hit];
+
+      // get the hit association; will not exist for noise hits
+      auto hit_assoc_it = m_hit_assoc_index.find(ObjectKey(raw_hit.id()));
+      long i_hit_assoc  = hit_assoc_it != m_hit_assoc_index.end() ? static_cast<long>(hit_assoc_it->second) : -1;
+
+      // get MC photon(s), typically only used by cheat modes or trace logging
+      edm4hep::MCParticle mc_photon;
+      bool mc_photon_found = false;
+      if((m_cfg.cheatPhotonVertex || m_cfg.cheatTrueRadiator) && i_hit_assoc >= 0) {
+        auto hit_assoc = (*in_hit_assocs)[i_hit_assoc];
+        // FIXME: occasionally there will be more than one photon associated with a hit;
+        // for now let's just take the first one...
+        if(hit_assoc.simHits_size() > 0) {
+          mc_photon = hit_assoc.getSimHits(0).getMCParticle();
+          mc_photon_found = true;
+          if(mc_photon.getPDG() != -22)
+            m_log->warn("non-opticalphoton hit: PDG = {}",mc_photon.getPDG());
         }
+        else if(m_cfg.CheatModeEnabled())
+          m_log->error("cheat mode enabled, but no MC photons provided");
+      }
+
+      // cheat mode, for testing only: use MC photon to get the actual radiator
+      if(m_cfg.cheatTrueRadiator && mc_photon_found) {
+        auto vtx    = Tools::PodioVector3_to_TVector3(mc_photon.getVertex());
+        auto mc_rad = worker.irt_det->GuessRadiator(vtx, vtx); // assume IP is at (0,0,0)
+        if(mc_rad != irt_rad) continue; // skip this photon, if not from radiator `irt_rad`
+        Tools::PrintTVector3(m_log, fmt::format("cheat: radiator '{}' determined from photon vertex", rad_name), vtx);
+      }
 
-        // start new IRT photon
-        auto *irt_sensor = m_irt_det->m_PhotonDetectors[0]; // NOTE: assumes one sensor type
-        auto *irt_photon = new OpticalPhoton(); // new raw pointer; it will also be destroyed when `irt_particle` is destroyed
-        irt_photon->SetVolumeCopy(sensor_id);
-        irt_photon->SetDetectionPosition(pixel_pos);
-        irt_photon->SetPhotonDetector(irt_sensor);
-        irt_photon->SetDetected(true);
-
-        // cheat mode: get photon vertex info from MC truth
-        if((m_cfg.cheatPhotonVertex || m_cfg.cheatTrueRadiator) && mc_photon_found) {
-          irt_photon->SetVertexPosition(Tools::PodioVector3_to_TVector3(mc_photon.getVertex()));
-          irt_photon->SetVertexMomentum(Tools::PodioVector3_to_TVector3(mc_photon.getMomentum()));
+      // get sensor and pixel info
+      // FIXME: signal and timing cuts (ADC, TDC, ToT, ...)
+      auto     cell_id   = raw_hit.getCellID();
+      uint64_t sensor_id = cell_id & m_cell_mask;
+      TVector3 pixel_pos = worker.irt_det->m_ReadoutIDToPosition(cell_id);
+
+      // trace logging
+      if(m_log->level() <= spdlog::level::trace) {
+        m_log->trace("cell_id={:#X}  sensor_id={:#X}", cell_id, sensor_id);
+        Tools::PrintTVector3(m_log, "pixel position", pixel_pos);
+        if(mc_photon_found) {
+          TVector3 mc_endpoint = Tools::PodioVector3_to_TVector3(mc_photon.getEndpoint());
+          Tools::PrintTVector3(m_log, "photon endpoint", mc_endpoint);
+          m_log->trace("{:>30} = {}", "dist( pixel,  photon )", (pixel_pos  - mc_endpoint).Mag());
         }
+        else m_log->trace("  no MC photon found; probably a noise hit");
+      }
 
-        // cheat mode: retrieve a refractive index estimate; it is not exactly the one, which
-        // was used in GEANT, but should be very close
-        if(m_cfg.cheatPhotonVertex) {
-          double ri;
-          auto mom    = 1e9 * irt_photon->GetVertexMomentum().Mag();
-          auto ri_set = Tools::GetFinelyBinnedTableEntry(irt_rad->m_ri_lookup_table, mom, &ri);
-          if(ri_set) {
-            irt_photon->SetVertexRefractiveIndex(ri);
-            m_log->trace("{:>30} = {}", "refractive index", ri);
-          }
-          else
-            m_log->warn("Tools::GetFinelyBinnedTableEntry failed to lookup refractive index for momentum {} eV", mom);
+      // start new IRT photon
+      auto *irt_sensor = worker.irt_det->m_PhotonDetectors[0]; // NOTE: assumes one sensor type
+      auto *irt_photon = worker.photon_pool.Acquire();
+      irt_photon->SetVolumeCopy(sensor_id);
+      irt_photon->SetDetectionPosition(pixel_pos);
+      irt_photon->SetPhotonDetector(irt_sensor);
+      irt_photon->SetDetected(true);
+
+      // cheat mode: get photon vertex info from MC truth
+      if((m_cfg.cheatPhotonVertex || m_cfg.cheatTrueRadiator) && mc_photon_found) {
+        irt_photon->SetVertexPosition(Tools::PodioVector3_to_TVector3(mc_photon.getVertex()));
+        irt_photon->SetVertexMomentum(Tools::PodioVector3_to_TVector3(mc_photon.getMomentum()));
+      }
+
+      // cheat mode: retrieve a refractive index estimate; it is not exactly the one, which
+      // was used in GEANT, but should be very close
+      if(m_cfg.cheatPhotonVertex) {
+        double ri;
+        auto mom    = 1e9 * irt_photon->GetVertexMomentum().Mag();
+        auto ri_set = Tools::GetFinelyBinnedTableEntry(irt_rad->m_ri_lookup_table, mom, &ri);
+        if(ri_set) {
+          irt_photon->SetVertexRefractiveIndex(ri);
+          m_log->trace("{:>30} = {}", "refractive index", ri);
         }
+        else
+          m_log->warn("Tools::GetFinelyBinnedTableEntry failed to lookup refractive index for momentum {} eV", mom);
+      }
 
-        // add each `irt_photon` to the radiator history
-        // - unless cheating, we don't know which photon goes with which
-        // radiator, thus we add them all to each radiator; the radiators'
-        // photons are mixed in `ChargedParticle::PIDReconstruction`
-        irt_rad_history->AddOpticalPhoton(irt_photon);
-        /* FIXME: this considers ALL of the `irt_photon`s... we can limit this
-         * once we add the ability to get a fiducial volume for each track, i.e.,
-         * a region of sensors where we expect to see this `irt_particle`'s
-         * Cherenkov photons; this should also combat sensor noise
-         */
-      } // end `in_hit_assocs` loop
+      // add each `irt_photon` to the radiator history
+      // - unless cheating, we don't know which photon goes with which
+      // radiator, thus we add all preselected hits to each radiator; the radiators'
+      // photons are mixed in `ChargedParticle::PIDReconstruction`
+      irt_rad_history->AddOpticalPhoton(irt_photon);
+      photon_hit_assocs.push_back(i_hit_assoc);
+    } // end `in_hit_assocs` loop
 
-    } // end radiator loop
+  } // end radiator loop
 
 
 
-    // particle identification +++++++++++++++++++++++++++++++++++++++++++++++++++++
+  // particle identification +++++++++++++++++++++++++++++++++++++++++++++++++++++
 
-    // define a mass hypothesis for each particle we want to check
-    m_log->trace("{:+^70}"," PARTICLE IDENTIFICATION ");
-    CherenkovPID irt_pid;
-    std::unordered_map<int,MassHypothesis*> pdg_to_hyp; // `pdg` -> hypothesis
-    for(auto [pdg,mass] : m_pdg_mass) {
-      irt_pid.AddMassHypothesis(mass);
-      pdg_to_hyp.insert({ pdg, irt_pid.GetHypothesis(irt_pid.GetHypothesesCount()-1) });
-    }
+  // define a mass hypothesis for each particle we want to check
+  m_log->trace("{:+^70}"," PARTICLE IDENTIFICATION ");
+  CherenkovPID irt_pid;
+  std::unordered_map<int,MassHypothesis*> pdg_to_hyp; // `pdg` -> hypothesis
+  for(auto [pdg,mass] : m_pdg_mass) {
+    irt_pid.AddMassHypothesis(mass);
+    pdg_to_hyp.insert({ pdg, irt_pid.GetHypothesis(irt_pid.GetHypothesesCount()-1) });
+  }
 
-    // run IRT PID
-    irt_particle->PIDReconstruction(irt_pid);
-    m_log->trace("{:-^70}"," IRT RESULTS ");
-
-    // loop over radiators
-    for(auto [rad_name,irt_rad] : m_pid_radiators) {
-      m_log->trace("-> {} Radiator (ID={}):", rad_name, irt_rad->m_ID);
-
-      // Cherenkov angle (theta) estimate
-      unsigned npe        = 0;
-      double   rindex_ave = 0.0;
-      double   energy_ave = 0.0;
-      std::vector<std::pair<double,double>> phot_theta_phi;
-
-      // loop over this radiator's photons, and decide which to include in the theta estimate
-      auto *irt_rad_history = irt_particle->FindRadiatorHistory(irt_rad);
-      if(irt_rad_history==nullptr) {
-        m_log->trace("  No radiator history; skip");
-        continue;
-      }
-      m_log->trace("  Photoelectrons:");
-      for(auto *irt_photon : irt_rad_history->Photons()) {
-
-        // check whether this photon was selected by at least one mass hypothesis
-        bool photon_selected = false;
-        for(auto irt_photon_sel : irt_photon->_m_Selected) {
-          if(irt_photon_sel.second == irt_rad) {
-            photon_selected = true;
-            break;
-          }
-        }
-        if(!photon_selected) continue;
-
-        // trace logging
-        Tools::PrintTVector3(
-            m_log,
-            fmt::format("- sensor_id={:#X}: hit",irt_photon->GetVolumeCopy()),
-            irt_photon->GetDetectionPosition()
-            );
-        Tools::PrintTVector3(m_log, "photon vertex", irt_photon->GetVertexPosition());
-
-        // get this photon's theta and phi estimates
-        auto phot_theta = irt_photon->_m_PDF[irt_rad].GetAverage();
-        auto phot_phi   = irt_photon->m_Phi[irt_rad];
-
-        // add to the total
-        npe++;
-        phot_theta_phi.emplace_back( phot_theta, phot_phi );
-        if(m_cfg.cheatPhotonVertex) {
-          rindex_ave += irt_photon->GetVertexRefractiveIndex();
-          energy_ave += irt_photon->GetVertexMomentum().Mag();
-        }
+  // run IRT PID
+  irt_particle->PIDReconstruction(irt_pid);
+  m_log->trace("{:-^70}"," IRT RESULTS ");
+
+  // loop over radiators
+  for(auto [rad_name,irt_rad] : worker.pid_radiators) {
+    m_log->trace("-> {} Radiator (ID={}):", rad_name, irt_rad->m_ID);
 
-      } // end loop over this radiator's photons
+    // Cherenkov angle (theta) estimate
+    RadiatorResult rad_result;
+    rad_result.rad_name = rad_name;
 
-      // compute averages
-      if(npe>0) {
-        rindex_ave /= npe;
-        energy_ave /= npe;
+    // loop over this radiator's photons, and decide which to include in the theta estimate
+    auto *irt_rad_history = irt_particle->FindRadiatorHistory(irt_rad);
+    if(irt_rad_history==nullptr) {
+      m_log->trace("  No radiator history; skip");
+      continue;
+    }
+    const auto& photon_hit_assocs = worker.photon_hit_assocs.at(rad_name);
+    std::size_t i_photon = 0;
+    m_log->trace("  Photoelectrons:");
+    for(auto *irt_photon : irt_rad_history->Photons()) {
+      auto i_hit_assoc = photon_hit_assocs.at(i_photon++);
+
+      // check whether this photon was selected by at least one mass hypothesis
+      bool photon_selected = false;
+      for(auto irt_photon_sel : irt_photon->_m_Selected) {
+        if(irt_photon_sel.second == irt_rad) {
+          photon_selected = true;
+          break;
+        }
+      }
+      if(!photon_selected) continue;
+
+      // trace logging
+      Tools::PrintTVector3(
+          m_log,
+          fmt::format("- sensor_id={:#X}: hit",irt_photon->GetVolumeCopy()),
+          irt_photon->GetDetectionPosition()
+          );
+      Tools::PrintTVector3(m_log, "photon vertex", irt_photon->GetVertexPosition());
+
+      // get this photon's theta and phi estimates
+      auto phot_theta = irt_photon->_m_PDF[irt_rad].GetAverage();
+      auto phot_phi   = irt_photon->m_Phi[irt_rad];
+
+      // add to the total
+      rad_result.npe++;
+      rad_result.theta_phi.emplace_back( phot_theta, phot_phi );
+      if(i_hit_assoc >= 0)
+        rad_result.hit_assocs.push_back(i_hit_assoc);
+      if(m_cfg.cheatPhotonVertex) {
+        rad_result.rindex_ave += irt_photon->GetVertexRefractiveIndex();
+        rad_result.energy_ave += irt_photon->GetVertexMomentum().Mag();
       }
 
-      // fill photon info
-      auto out_cherenkov_pid = result.at(rad_name)->create();
-      out_cherenkov_pid.setNpe(static_cast<decltype(edm4eic::CherenkovParticleIDData::npe)>(npe));
-      out_cherenkov_pid.setRefractiveIndex(static_cast<decltype(edm4eic::CherenkovParticleIDData::refractiveIndex)>(rindex_ave));
-      out_cherenkov_pid.setPhotonEnergy(static_cast<decltype(edm4eic::CherenkovParticleIDData::photonEnergy)>(energy_ave));
-      for(auto [phot_theta,phot_phi] : phot_theta_phi)
-        out_cherenkov_pid.addToThetaPhiPhotons(edm4hep::Vector2f{
-            static_cast<float>(phot_theta),
-            static_cast<float>(phot_phi)
-            });
+    } // end loop over this radiator's photons
 
-      // relate mass hypotheses
-      for(auto [pdg,mass] : m_pdg_mass) {
+    // compute averages
+    if(rad_result.npe>0) {
+      rad_result.rindex_ave /= rad_result.npe;
+      rad_result.energy_ave /= rad_result.npe;
+    }
 
-        // get hypothesis results
-        auto *irt_hypothesis = pdg_to_hyp.at(pdg);
-        auto hyp_weight     = irt_hypothesis->GetWeight(irt_rad);
-        auto hyp_npe        = irt_hypothesis->GetNpe(irt_rad);
+    // mass hypotheses
+    for(auto [pdg,mass] : m_pdg_mass) {
 
-        // fill `ParticleID` output collection
-        edm4eic::CherenkovParticleIDHypothesis out_hypothesis;
-        out_hypothesis.PDG    = static_cast<decltype(edm4eic::CherenkovParticleIDHypothesis::PDG)>(pdg);
-        out_hypothesis.weight = static_cast<decltype(edm4eic::CherenkovParticleIDHypothesis::weight)>(hyp_weight);
-        out_hypothesis.npe    = static_cast<decltype(edm4eic::CherenkovParticleIDHypothesis::npe)>(hyp_npe);
+      // get hypothesis results
+      auto *irt_hypothesis = pdg_to_hyp.at(pdg);
+      auto hyp_weight     = irt_hypothesis->GetWeight(irt_rad);
+      auto hyp_npe        = irt_hypothesis->GetNpe(irt_rad);
 
-        // relate
-        out_cherenkov_pid.addToHypotheses(out_hypothesis);
+      // fill `ParticleID` output collection
+      edm4eic::CherenkovParticleIDHypothesis out_hypothesis;
+      out_hypothesis.PDG    = static_cast<decltype(edm4eic::CherenkovParticleIDHypothesis::PDG)>(pdg);
+      out_hypothesis.weight = static_cast<decltype(edm4eic::CherenkovParticleIDHypothesis::weight)>(hyp_weight);
+      out_hypothesis.npe    = static_cast<decltype(edm4eic::CherenkovParticleIDHypothesis::npe)>(hyp_npe);
+      rad_result.hypotheses.push_back(out_hypothesis);
 
-      } // end hypothesis loop
+    } // end hypothesis loop
 
-      // logging
-      Tools::PrintCherenkovEstimate(m_log, out_cherenkov_pid);
+    particle_result.push_back(std::move(rad_result));
 
-      // relate charged particle projection
-      auto charged_particle_list_it = in_charged_particles.find("Merged");
-      if(charged_particle_list_it != in_charged_particles.end()) {
-        const auto *charged_particle_list = charged_particle_list_it->second;
-        auto charged_particle      = charged_particle_list->at(i_charged_particle);
-        out_cherenkov_pid.setChargedParticle(charged_particle);
-      }
-      else
-        m_log->error("Cannot find radiator 'Merged' in `in_charged_particles`");
+  } // end radiator loop
 
-      // relate hit associations
-      for(const auto& hit_assoc : *in_hit_assocs)
-        out_cherenkov_pid.addToRawHitAssociations(hit_assoc);
+  /* NOTE: `unique_ptr irt_particle` goes out of scope and will now be destroyed, and along with it:
+   * - raw pointer `irt_rad_history` for each radiator
+   * the `irt_photon`s are detached first, and stay in `worker.photon_pool` for the next charged particle
+   */
 
-    } // end radiator loop
+  return particle_result;
+}
 
-    /* NOTE: `unique_ptr irt_particle` goes out of scope and will now be destroyed, and along with it:
-     * - raw pointer `irt_rad_history` for each radiator
-     * - all `irt_photon` raw pointers
-     */
 
-  } // end `in_charged_particles` loop
+// SelectHits
+//---------------------------------------------------------------------------
+void eicrecon::IrtCherenkovParticleID::SelectHits(
+    Worker&                      worker,
+    const edm4eic::TrackSegment& charged_particle,
+    const std::string&           rad_name,
+    std::size_t                  num_raw_hits
+    ) const
+{
+  worker.selected_hits.clear();
+
+  // the track direction in this radiator, and how much it changes along the trajectory
+  TVector3 direction;
+  if(!m_sensor_hits.empty()) {
+    for(const auto& point : charged_particle.getPoints()) {
+      auto momentum = Tools::PodioVector3_to_TVector3(point.momentum);
+      if(momentum.Mag2() > 0)
+        direction += momentum.Unit();
+    }
+  }
 
-  return result;
+  // without preselection, use all hits
+  if(m_sensor_hits.empty() || direction.Mag2() <= 0) {
+    worker.selected_hits.resize(num_raw_hits);
+    for(std::size_t i_raw_hit = 0; i_raw_hit < num_raw_hits; i_raw_hit++)
+      worker.selected_hits[i_raw_hit] = i_raw_hit;
+    return;
+  }
+  direction = direction.Unit();
+  double spread = 0.0;
+  for(const auto& point : charged_particle.getPoints()) {
+    auto momentum = Tools::PodioVector3_to_TVector3(point.momentum);
+    if(momentum.Mag2() > 0)
+      spread = std::max(spread, direction.Angle(momentum));
+  }
+
+  // find the reachable sensors, and collect their hits
+  auto max_angle = m_max_cherenkov_angle.at(rad_name) + spread + m_cfg.fiducialMargin;
+  m_sensor_index.FindReachableSensors(direction, max_angle, worker.reachable_sensors);
+  for(auto sensor_id : worker.reachable_sensors) {
+    auto hits_begin = std::lower_bound(m_sensor_hits.begin(), m_sensor_hits.end(), std::make_pair(sensor_id, std::size_t(0)));
+    for(auto it = hits_begin; it != m_sensor_hits.end() && it->first == sensor_id; ++it)
+      worker.selected_hits.push_back(it->second);
+  }
+
+  // keep the original hit order
+  std::sort(worker.selected_hits.begin(), worker.selected_hits.end());
 }
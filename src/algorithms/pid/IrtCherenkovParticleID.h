@@ -6,20 +6,30 @@
 #include <IRT/CherenkovDetector.h>
 #include <IRT/CherenkovDetectorCollection.h>
 #include <IRT/CherenkovRadiator.h>
+#include <IRT/OpticalPhoton.h>
 #include <edm4eic/CherenkovParticleIDCollection.h>
+#include <edm4eic/CherenkovParticleIDHypothesis.h>
 #include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
 #include <edm4eic/RawTrackerHitCollection.h>
 #include <edm4eic/TrackSegmentCollection.h>
+#include <podio/ObjectID.h>
+#include <spdlog/common.h>
 #include <spdlog/logger.h>
 #include <stdint.h>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 // EICrecon
+#include "CherenkovSensorIndex.h"
 #include "IrtCherenkovParticleIDConfig.h"
+#include "ObjectPool.h"
 #include "algorithms/interfaces/WithPodConfig.h"
+#include "algorithms/interfaces/WorkerPool.h"
 
 namespace eicrecon {
 
@@ -29,9 +39,15 @@ namespace eicrecon {
       IrtCherenkovParticleID() = default;
       ~IrtCherenkovParticleID() {}
 
+      // AlgorithmInit
+      // - `irt_det_colls` has one IRT geometry for each worker thread, see `numThreads`; IRT keeps
+      //   the state of the current charged particle in its radiators, so workers cannot share one;
+      //   with smearing, only the first is used, since IRT smears with the shared `gRandom`
+      // - `sensor_geometry` is used to build the sensor index for the fiducial preselection of hits
       void AlgorithmInit(
-          CherenkovDetectorCollection*     irt_det_coll,
-          std::shared_ptr<spdlog::logger>& logger
+          const std::vector<CherenkovDetectorCollection*>& irt_det_colls,
+          const CherenkovSensorGeometry&                    sensor_geometry,
+          std::shared_ptr<spdlog::logger>&                 logger
           );
       void AlgorithmChangeRun();
 
@@ -50,14 +66,67 @@ namespace eicrecon {
 
     private:
 
+      // IRT geometry and scratch space of one worker thread
+      struct Worker {
+        CherenkovDetectorCollection*             irt_det_coll;
+        CherenkovDetector*                       irt_det;
+        std::map<std::string,CherenkovRadiator*> pid_radiators;
+        ObjectPool<OpticalPhoton>                photon_pool;       // IRT photons, reused for each charged particle
+        std::vector<uint64_t>                    reachable_sensors;
+        std::vector<std::size_t>                 selected_hits;
+        std::map<std::string,std::vector<long>>  photon_hit_assocs; // radiator name -> for each photon, index in `in_hit_assocs`, or -1
+      };
+
+      // PID estimate of one charged particle in one radiator; filled into the output collections in particle order
+      struct RadiatorResult {
+        std::string                                         rad_name;
+        unsigned                                            npe        = 0;
+        double                                              rindex_ave = 0.0;
+        double                                              energy_ave = 0.0;
+        std::vector<std::pair<double,double>>               theta_phi;
+        std::vector<edm4eic::CherenkovParticleIDHypothesis> hypotheses;
+        std::vector<long>                                   hit_assocs; // indices in `in_hit_assocs`
+      };
+      using ParticleResult = std::vector<RadiatorResult>;
+
       std::shared_ptr<spdlog::logger> m_log;
-      CherenkovDetectorCollection*    m_irt_det_coll;
-      CherenkovDetector*              m_irt_det;
+      std::vector<Worker>             m_workers;
+      WorkerPool                      m_pool;    // one thread for each worker, the first is the calling thread
 
       uint64_t    m_cell_mask;
       std::string m_det_name;
-      std::unordered_map<int,double>           m_pdg_mass;
-      std::map<std::string,CherenkovRadiator*> m_pid_radiators;
+      std::unordered_map<int,double> m_pdg_mass;
+
+      // fiducial preselection
+      CherenkovSensorIndex                         m_sensor_index;
+      std::map<std::string,double>                 m_max_cherenkov_angle; // radiator name -> max. Cherenkov angle
+      std::vector<std::pair<uint64_t,std::size_t>> m_sensor_hits;         // (sensor ID, raw hit index), sorted
+
+      // MC associations: raw hit ObjectID key -> index in `in_hit_assocs`, built once per event
+      std::unordered_map<uint64_t,std::size_t> m_hit_assoc_index;
+      static uint64_t ObjectKey(const podio::ObjectID& id) {
+        return (static_cast<uint64_t>(id.collectionID) << 32) | static_cast<uint32_t>(id.index);
+      }
+
+      // set up a worker for the first `CherenkovDetector` of `irt_det_coll`, configuring its radiators
+      Worker InitWorker(CherenkovDetectorCollection* irt_det_coll, spdlog::level::level_enum lvl);
+
+      // run IRT for one charged particle
+      ParticleResult ProcessParticle(
+          Worker&                                                        worker,
+          std::size_t                                                    i_charged_particle,
+          std::map<std::string, const edm4eic::TrackSegmentCollection*>& in_charged_particles,
+          const edm4eic::RawTrackerHitCollection*                        in_raw_hits,
+          const edm4eic::MCRecoTrackerHitAssociationCollection*          in_hit_assocs
+          );
+
+      // fill `worker.selected_hits` with the indices of the raw hits to use for this track and radiator
+      void SelectHits(
+          Worker&                      worker,
+          const edm4eic::TrackSegment& charged_particle,
+          const std::string&           rad_name,
+          std::size_t                  num_raw_hits
+          ) const;
 
   };
 }
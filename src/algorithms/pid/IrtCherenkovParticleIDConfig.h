@@ -26,6 +26,12 @@ namespace eicrecon {
 
       unsigned numRIndexBins = 100; // number of bins to interpolate the refractive index vs. energy
 
+      /* threads to process the charged particles of one event; 1 is serial, as is any smearing (IRT uses gRandom)
+       * - each JANA thread runs its own instance with its own threads and IRT geometries, so the
+       *   total is `numThreads` times the number of JANA threads; use it when JANA has few threads
+       */
+      unsigned numThreads = 1;
+
       /* radiator-specific settings; handled by `RadiatorConfig` struct (see above)
        * example: radiators.insert({ "Aerogel", RadiatorConfig{ ... }});
        *          radiators.insert({ "Gas", RadiatorConfig{ ... }});
@@ -37,6 +43,13 @@ namespace eicrecon {
        */
       std::vector<int> pdgList;
 
+      /* fiducial preselection of sensor hits: for each track and radiator, only use hits on sensors
+       * which its Cherenkov photons can reach, given the maximum Cherenkov angle plus a margin
+       * for the spread of the track direction and optical aberrations
+       */
+      bool   fiducialPreselection = true;
+      double fiducialMargin       = 0.1; // [radians]
+
       /* cheat modes: useful for test purposes, or idealizing; the real PID should run with all
        * cheat modes off
        */
@@ -77,6 +90,9 @@ namespace eicrecon {
           m_log->log(lvl, "  {:>20} = {:<}", name, val);
         };
         print_param("numRIndexBins",numRIndexBins);
+        print_param("numThreads",numThreads);
+        print_param("fiducialPreselection",fiducialPreselection);
+        print_param("fiducialMargin",fiducialMargin);
         PrintCheats(m_log, lvl, true);
         m_log->log(lvl, "pdgList:");
         for(const auto& pdg : pdgList) m_log->log(lvl, "  {}", pdg);
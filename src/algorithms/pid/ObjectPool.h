@@ -0,0 +1,51 @@
+// Copyright 2023, Christopher Dilks
+// Subject to the terms in the LICENSE file found in the top-level directory.
+//
+// Pool of reusable transient objects, e.g., IRT photons
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace eicrecon {
+
+  /* Objects are handed out by `Acquire`, reset to a default-constructed state, and stay owned
+   * by the pool; `Reset` makes all of them available again, typically at the start of an event.
+   * New objects are only allocated when more are in use than ever before, and `Allocations`
+   * counts them. Not thread safe: use one pool per algorithm instance, i.e., per thread.
+   */
+  template<class T>
+  class ObjectPool {
+    public:
+
+      ObjectPool() = default;
+
+      T* Acquire() {
+        ++m_acquired;
+        if(m_used < m_objects.size()) {
+          auto *obj = m_objects[m_used++].get();
+          *obj = T();
+          return obj;
+        }
+        m_objects.push_back(std::make_unique<T>());
+        ++m_used;
+        return m_objects.back().get();
+      }
+
+      void Reset() { m_used = 0; }
+
+      std::size_t InUse()       const { return m_used; }
+      std::size_t Acquired()    const { return m_acquired; }       // total number of `Acquire` calls
+      std::size_t Allocations() const { return m_objects.size(); } // total number of objects allocated
+
+    private:
+
+      std::vector<std::unique_ptr<T>> m_objects;
+      std::size_t                     m_used     = 0;
+      std::size_t                     m_acquired = 0;
+
+  };
+}
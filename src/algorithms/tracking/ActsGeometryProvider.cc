@@ -23,6 +23,7 @@
 #include <JANA/JException.h>
 #include <TGeoManager.h>
 #include <fmt/core.h>
+#include <fmt/format.h>
 #include <fmt/ostream.h>
 #include <spdlog/common.h>
 #include <stddef.h>
@@ -89,7 +90,9 @@ void draw_surfaces(std::shared_ptr<const Acts::TrackingGeometry> trk_geo, const
 void ActsGeometryProvider::initialize(const dd4hep::Detector* dd4hep_geo,
                                       std::string material_file,
                                       std::shared_ptr<spdlog::logger> log,
-                                      std::shared_ptr<spdlog::logger> init_log) {
+                                      std::shared_ptr<spdlog::logger> init_log,
+                                      std::optional<eicrecon::BField::DD4hepBField::GridConfig> field_grid,
+                                      std::size_t field_grid_validation) {
     // LOGGING
     m_log = log;
     m_init_log = init_log;
@@ -183,8 +186,6 @@ void ActsGeometryProvider::initialize(const dd4hep::Detector* dd4hep_geo,
     // Visit surfaces
     m_init_log->info("Checking surfaces...");
     if (m_trackingGeo) {
-        draw_surfaces(m_trackingGeo, m_trackingGeoCtx, "tracking_geometry.obj");
-
         m_init_log->debug("visiting all the surfaces  ");
         m_trackingGeo->visitSurfaces([this](const Acts::Surface *surface) {
             // for now we just require a valid surface
@@ -221,7 +222,23 @@ void ActsGeometryProvider::initialize(const dd4hep::Detector* dd4hep_geo,
 
     // Load ACTS magnetic field
     m_init_log->info("Loading magnetic field...");
-    m_magneticField = std::make_shared<const eicrecon::BField::DD4hepBField>(m_dd4hepDetector);
+    if (field_grid) {
+        m_init_log->info("Precomputing magnetic field on grid x [{}, {}], y [{}, {}], z [{}, {}] mm with steps {} mm...",
+                         field_grid->min[0], field_grid->max[0],
+                         field_grid->min[1], field_grid->max[1],
+                         field_grid->min[2], field_grid->max[2],
+                         fmt::join(field_grid->step, ", "));
+        m_magneticField = std::make_shared<const eicrecon::BField::DD4hepBField>(m_dd4hepDetector, *field_grid);
+        if (field_grid_validation > 0) {
+            auto validation = m_magneticField->validateGrid(field_grid_validation);
+            m_init_log->info("Magnetic field grid: max deviation from exact field over {} points is {} T at ({}) mm",
+                             validation.samples,
+                             validation.maxDeviation / Acts::UnitConstants::T,
+                             validation.position.transpose());
+        }
+    } else {
+        m_magneticField = std::make_shared<const eicrecon::BField::DD4hepBField>(m_dd4hepDetector);
+    }
     Acts::MagneticFieldContext m_fieldctx{eicrecon::BField::BFieldVariant(m_magneticField)};
     auto bCache = m_magneticField->makeCache(m_fieldctx);
     for (int z: {0, 500, 1000, 1500, 2000, 3000, 4000}) {
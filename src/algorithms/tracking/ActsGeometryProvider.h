@@ -20,9 +20,11 @@
 #include <DD4hep/Fields.h>
 #include <Evaluator/DD4hepUnits.h>
 #include <spdlog/logger.h>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -36,17 +38,26 @@ namespace dd4hep::rec {
  *  This is useful for debugging the ACTS geometry. The obj file can
  *  be loaded into various tools, such as FreeCAD, for inspection.
  */
-void draw_surfaces(std::shared_ptr<const Acts::TrackingGeometry> trk_geo, const std::string &fname);
+void draw_surfaces(std::shared_ptr<const Acts::TrackingGeometry> trk_geo, const Acts::GeometryContext geo_ctx,
+                   const std::string &fname);
 
 class ActsGeometryProvider {
 public:
     ActsGeometryProvider() {}
     using VolumeSurfaceMap = std::unordered_map<uint64_t, const Acts::Surface *>;
 
+    /** Converts the geometry and sets up the magnetic field.
+     *
+     * If field_grid is given, the field is precomputed on that grid and
+     * interpolated, and compared to the exact field at field_grid_validation
+     * random points.
+     */
     virtual void initialize(const dd4hep::Detector* dd4hep_geo,
                             std::string material_file,
                             std::shared_ptr<spdlog::logger> log,
-                            std::shared_ptr<spdlog::logger> init_log) final;
+                            std::shared_ptr<spdlog::logger> init_log,
+                            std::optional<eicrecon::BField::DD4hepBField::GridConfig> field_grid = std::nullopt,
+                            std::size_t field_grid_validation = 0) final;
 
     const dd4hep::Detector* dd4hepDetector() const { return m_dd4hepDetector; }
 
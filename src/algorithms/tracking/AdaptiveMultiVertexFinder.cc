@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include "AdaptiveMultiVertexFinder.h"
+
+#include <Acts/Definitions/Algebra.hpp>
+#include <Acts/EventData/TrackParameters.hpp>
+#include <Acts/MagneticField/MagneticFieldContext.hpp>
+#include <Acts/Propagator/EigenStepper.hpp>
+#include <Acts/Propagator/Propagator.hpp>
+#include <Acts/Utilities/AnnealingUtility.hpp>
+#include <Acts/Utilities/Result.hpp>
+#include <Acts/Vertexing/AdaptiveMultiVertexFinder.hpp>
+#include <Acts/Vertexing/AdaptiveMultiVertexFitter.hpp>
+#include <Acts/Vertexing/GaussianTrackDensity.hpp>
+#include <Acts/Vertexing/HelicalTrackLinearizer.hpp>
+#include <Acts/Vertexing/ImpactPointEstimator.hpp>
+#include <Acts/Vertexing/TrackDensityVertexFinder.hpp>
+#include <Acts/Vertexing/Vertex.hpp>
+#include <Acts/Vertexing/VertexingOptions.hpp>
+#include <edm4eic/Cov3f.h>
+#include <Eigen/Core>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <variant>
+
+namespace eicrecon {
+
+namespace {
+using Propagator           = Acts::Propagator<Acts::EigenStepper<>>;
+using Linearizer           = Acts::HelicalTrackLinearizer<Propagator>;
+using VertexFitter         = Acts::AdaptiveMultiVertexFitter<Acts::BoundTrackParameters, Linearizer>;
+using ImpactPointEstimator = Acts::ImpactPointEstimator<Acts::BoundTrackParameters, Propagator>;
+using VertexSeeder         = Acts::TrackDensityVertexFinder<VertexFitter, Acts::GaussianTrackDensity<Acts::BoundTrackParameters>>;
+using VertexFinder         = Acts::AdaptiveMultiVertexFinder<VertexFitter, VertexSeeder>;
+using VertexFinderOptions  = Acts::VertexingOptions<Acts::BoundTrackParameters>;
+} // namespace
+
+struct AdaptiveMultiVertexFinder::Finder {
+  // members are initialized in order, the finder copies the components before it
+  std::shared_ptr<Propagator> propagator;
+  Linearizer linearizer;
+  ImpactPointEstimator ipEst;
+  VertexFinder finder;
+
+  Finder(const std::shared_ptr<const eicrecon::BField::DD4hepBField>& bfield, const AdaptiveMultiVertexFinderConfig& cfg)
+      : propagator(std::make_shared<Propagator>(Acts::EigenStepper<>(bfield)))
+      , linearizer(Linearizer::Config(bfield, propagator))
+      , ipEst(ImpactPointEstimator::Config(bfield, propagator))
+      , finder(finderConfig(bfield, cfg)) {}
+
+  VertexFinder::Config finderConfig(const std::shared_ptr<const eicrecon::BField::DD4hepBField>& bfield,
+                                    const AdaptiveMultiVertexFinderConfig& cfg) const {
+    // Set up the vertex fitter with deterministic annealing
+    Acts::AnnealingUtility::Config annealingCfg;
+    annealingCfg.setOfTemperatures = cfg.m_annealingTemperatures;
+    VertexFitter::Config fitterCfg(ipEst);
+    fitterCfg.annealingTool = Acts::AnnealingUtility(annealingCfg);
+    fitterCfg.minWeight     = cfg.m_minWeight;
+    fitterCfg.doSmoothing   = cfg.m_doSmoothing;
+    VertexFitter fitter(fitterCfg);
+
+    // Set up the seed finder
+    VertexSeeder seeder;
+
+    // Set up the actual vertex finder
+    VertexFinder::Config finderCfg(std::move(fitter), seeder, ipEst, linearizer, bfield);
+    finderCfg.useBeamSpotConstraint      = cfg.m_useBeamSpotConstraint;
+    finderCfg.tracksMaxSignificance      = cfg.m_tracksMaxSignificance;
+    finderCfg.maxVertexChi2              = cfg.m_maxVertexChi2;
+    finderCfg.maxMergeVertexSignificance = cfg.m_maxMergeVertexSignificance;
+    finderCfg.maxIterations              = cfg.m_maxIterations;
+    return finderCfg;
+  }
+};
+
+} // namespace eicrecon
+
+eicrecon::AdaptiveMultiVertexFinder::AdaptiveMultiVertexFinder() = default;
+
+eicrecon::AdaptiveMultiVertexFinder::~AdaptiveMultiVertexFinder() = default;
+
+void eicrecon::AdaptiveMultiVertexFinder::init(std::shared_ptr<const ActsGeometryProvider> geo_svc,
+                                               std::shared_ptr<spdlog::logger> log) {
+
+  m_log = log;
+
+  m_geoSvc = geo_svc;
+
+  m_BField =
+      std::dynamic_pointer_cast<const eicrecon::BField::DD4hepBField>(m_geoSvc->getFieldProvider());
+  m_fieldctx = eicrecon::BField::BFieldVariant(m_BField);
+
+  m_finder = std::make_unique<Finder>(m_BField, m_cfg);
+}
+
+std::unique_ptr<edm4eic::VertexCollection> eicrecon::AdaptiveMultiVertexFinder::produce(
+    std::vector<const ActsExamples::Trajectories*> trajectories) {
+
+  const auto start = std::chrono::steady_clock::now();
+
+  auto outputVertices = std::make_unique<edm4eic::VertexCollection>();
+
+  VertexFinder::State state;
+  VertexFinderOptions finderOpts(m_geoctx, m_fieldctx);
+
+  std::vector<const Acts::BoundTrackParameters*> inputTrackPointers;
+
+  for (const auto& trajectory : trajectories) {
+    auto tips = trajectory->tips();
+    if (tips.empty()) {
+      continue;
+    }
+    /// CKF can provide multiple track trajectories for a single input seed
+    for (auto& tip : tips) {
+      inputTrackPointers.push_back(&(trajectory->trackParameters(tip)));
+    }
+  }
+
+  std::vector<Acts::Vertex<Acts::BoundTrackParameters>> vertices;
+  auto result = m_finder->finder.find(inputTrackPointers, finderOpts, state);
+  if (result.ok()) {
+    vertices = std::move(result.value());
+  } else {
+    m_log->debug("Vertex finding failed: {}", result.error().message());
+  }
+
+  for (const auto& vtx : vertices) {
+    edm4eic::Cov3f cov(vtx.covariance()(0, 0), vtx.covariance()(1, 1), vtx.covariance()(2, 2),
+                       vtx.covariance()(0, 1), vtx.covariance()(0, 2), vtx.covariance()(1, 2));
+
+    auto eicvertex = outputVertices->create();
+    eicvertex.setPrimary(1);                                  // boolean flag if vertex is primary vertex of event
+    eicvertex.setChi2((float)vtx.fitQuality().first);         // chi2
+    eicvertex.setProbability((float)vtx.fitQuality().second); // ndf
+    eicvertex.setPosition({
+         (float)vtx.position().x(),
+         (float)vtx.position().y(),
+         (float)vtx.position().z()
+    }); // vtxposition
+    eicvertex.setPositionError(cov);                          // covariance
+    eicvertex.setAlgorithmType(2);                            // algorithmtype
+    eicvertex.setTime((float)vtx.time());                     // time
+  }
+
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  m_log->debug("Found {} vertices from {} tracks in {:.3f} ms", outputVertices->size(), inputTrackPointers.size(), elapsed.count());
+
+  return std::move(outputVertices);
+}
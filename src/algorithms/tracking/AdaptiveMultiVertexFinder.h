@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <Acts/Geometry/GeometryContext.hpp>
+#include <Acts/MagneticField/MagneticFieldContext.hpp>
+#include <edm4eic/VertexCollection.h>
+#include <spdlog/logger.h>
+#include <memory>
+#include <vector>
+
+#include "ActsExamples/EventData/Trajectories.hpp"
+#include "ActsGeometryProvider.h"
+#include "AdaptiveMultiVertexFinderConfig.h"
+#include "DD4hepBField.h"
+#include "algorithms/interfaces/WithPodConfig.h"
+
+namespace eicrecon {
+
+/** Primary vertexing with the ACTS adaptive multi-vertex finder (AMVF).
+ *
+ * All vertices are fitted together, with tracks shared between them by
+ * annealed weights. Compared to IterativeVertexFinder, the cost grows more
+ * slowly with the number of tracks, which suits events with pile-up.
+ */
+class AdaptiveMultiVertexFinder
+    : public eicrecon::WithPodConfig<eicrecon::AdaptiveMultiVertexFinderConfig> {
+public:
+  AdaptiveMultiVertexFinder();
+  ~AdaptiveMultiVertexFinder();
+
+  void init(std::shared_ptr<const ActsGeometryProvider> geo_svc,
+            std::shared_ptr<spdlog::logger> log);
+  std::unique_ptr<edm4eic::VertexCollection>
+  produce(std::vector<const ActsExamples::Trajectories*> trajectories);
+
+private:
+  /// ACTS vertex finder and its fitter, linearizer, seeder and propagator, built once in init()
+  struct Finder;
+  std::unique_ptr<Finder> m_finder;
+
+  std::shared_ptr<spdlog::logger> m_log;
+  std::shared_ptr<const ActsGeometryProvider> m_geoSvc;
+
+  std::shared_ptr<const eicrecon::BField::DD4hepBField> m_BField = nullptr;
+  Acts::GeometryContext m_geoctx;
+  Acts::MagneticFieldContext m_fieldctx;
+};
+} // namespace eicrecon
@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <vector>
+
+namespace eicrecon {
+
+struct AdaptiveMultiVertexFinderConfig {
+  // vertex finder
+  double m_tracksMaxSignificance      = 5.;
+  double m_maxVertexChi2              = 18.42;
+  double m_maxMergeVertexSignificance = 3.;
+  int m_maxIterations                 = 100;
+  bool m_useBeamSpotConstraint        = false;
+
+  // vertex fitter
+  double m_minWeight                  = 0.001;
+  bool m_doSmoothing                  = true;
+  std::vector<double> m_annealingTemperatures{8.0, 4.0, 2.0, 1.4142136, 1.2247449, 1.0};
+};
+
+} // namespace eicrecon
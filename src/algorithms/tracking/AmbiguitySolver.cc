@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include "AmbiguitySolver.h"
+
+#include <edm4eic/Measurement2D.h>
+#include <edm4eic/TrackParameters.h>
+#include <edm4eic/Trajectory.h>
+#include <fmt/core.h>
+#include <podio/ObjectID.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace eicrecon {
+
+void AmbiguitySolver::init(std::shared_ptr<spdlog::logger> log) {
+  m_log = log;
+}
+
+std::vector<bool> AmbiguitySolver::select(const std::vector<std::vector<std::uint64_t>>& measurements,
+                                          const std::vector<double>& chi2ndf) const {
+  const std::size_t n_tracks = measurements.size();
+  std::vector<bool> selected(n_tracks, false);
+
+  // quality criteria; a track without a finite chi2/ndf (e.g. ndf == 0) has no fit quality
+  // to compare, and would make the order in which shared tracks are removed arbitrary
+  for (std::size_t i = 0; i < n_tracks; ++i) {
+    selected[i] = measurements[i].size() >= m_cfg.m_minMeasurements
+                  && std::isfinite(chi2ndf[i]) && chi2ndf[i] <= m_cfg.m_maxChi2Ndf;
+  }
+
+  // selected tracks on each measurement
+  std::unordered_map<std::uint64_t, std::vector<std::size_t>> tracks_on_measurement;
+  for (std::size_t i = 0; i < n_tracks; ++i) {
+    if (!selected[i]) {
+      continue;
+    }
+    for (auto key : measurements[i]) {
+      tracks_on_measurement[key].push_back(i);
+    }
+  }
+
+  // measurements of each track that are shared with another selected track
+  std::vector<std::size_t> n_shared(n_tracks, 0);
+  for (const auto& [key, tracks] : tracks_on_measurement) {
+    if (tracks.size() > 1) {
+      for (auto i : tracks) {
+        n_shared[i]++;
+      }
+    }
+  }
+
+  for (std::size_t iteration = 0; iteration < m_cfg.m_maxIterations; ++iteration) {
+    // worst track above the shared measurement limit, the first one on a full tie
+    std::size_t worst = n_tracks;
+    double worst_fraction = 0;
+    for (std::size_t i = 0; i < n_tracks; ++i) {
+      if (!selected[i] || n_shared[i] <= m_cfg.m_maxSharedHits) {
+        continue;
+      }
+      const double fraction = static_cast<double>(n_shared[i]) / measurements[i].size();
+      if (worst == n_tracks || fraction > worst_fraction
+          || (fraction == worst_fraction && chi2ndf[i] > chi2ndf[worst])) {
+        worst = i;
+        worst_fraction = fraction;
+      }
+    }
+    if (worst == n_tracks) {
+      break;
+    }
+
+    m_log->trace("Removing track {} with {} of {} measurements shared", worst, n_shared[worst], measurements[worst].size());
+    selected[worst] = false;
+    for (auto key : measurements[worst]) {
+      auto& tracks = tracks_on_measurement[key];
+      if (tracks.size() == 2) {
+        // the other track no longer shares this measurement
+        n_shared[tracks[0] == worst ? tracks[1] : tracks[0]]--;
+      }
+      tracks.erase(std::find(tracks.begin(), tracks.end(), worst));
+    }
+  }
+
+  return selected;
+}
+
+std::tuple<
+    std::unique_ptr<edm4eic::TrajectoryCollection>,
+    std::unique_ptr<edm4eic::TrackParametersCollection>,
+    std::vector<ActsExamples::Trajectories*>
+>
+AmbiguitySolver::process(const edm4eic::TrajectoryCollection& trajectories,
+                         const std::vector<const ActsExamples::Trajectories*>& acts_trajectories) {
+
+  if (trajectories.size() != acts_trajectories.size()) {
+    throw std::runtime_error(fmt::format("AmbiguitySolver: {} trajectories but {} ACTS trajectories",
+                                         trajectories.size(), acts_trajectories.size()));
+  }
+
+  std::vector<std::vector<std::uint64_t>> measurements;
+  std::vector<double> chi2ndf;
+  measurements.reserve(trajectories.size());
+  chi2ndf.reserve(trajectories.size());
+  for (const auto& trajectory : trajectories) {
+    auto& keys = measurements.emplace_back();
+    keys.reserve(trajectory.measurementHits_size());
+    for (const auto& hit : trajectory.getMeasurementHits()) {
+      const auto id = hit.getObjectID();
+      keys.push_back((static_cast<std::uint64_t>(id.collectionID) << 32) | static_cast<std::uint32_t>(id.index));
+    }
+    chi2ndf.push_back(trajectory.getNdf() > 0 ? trajectory.getChi2() / trajectory.getNdf()
+                                              : std::numeric_limits<double>::infinity());
+  }
+
+  const auto selected = select(measurements, chi2ndf);
+
+  auto out_trajectories = std::make_unique<edm4eic::TrajectoryCollection>();
+  auto out_track_parameters = std::make_unique<edm4eic::TrackParametersCollection>();
+  std::vector<const ActsExamples::Trajectories*> out_acts_trajectories;
+
+  for (std::size_t i = 0; i < trajectories.size(); ++i) {
+    if (!selected[i]) {
+      continue;
+    }
+    const auto& trajectory = trajectories[i];
+
+    // Copy, rather than reference, so that the output does not depend on the unresolved collections
+    auto out = out_trajectories->create();
+    out.setType(trajectory.getType());
+    out.setChi2(trajectory.getChi2());
+    out.setNdf(trajectory.getNdf());
+    out.setNMeasurements(trajectory.getNMeasurements());
+    out.setNStates(trajectory.getNStates());
+    out.setNOutliers(trajectory.getNOutliers());
+    out.setNHoles(trajectory.getNHoles());
+    out.setNSharedHits(trajectory.getNSharedHits());
+    for (const auto& measurementChi2 : trajectory.getMeasurementChi2()) {
+      out.addToMeasurementChi2(measurementChi2);
+    }
+    for (const auto& outlierChi2 : trajectory.getOutlierChi2()) {
+      out.addToOutlierChi2(outlierChi2);
+    }
+    for (const auto& pars : trajectory.getTrackParameters()) {
+      auto out_pars = pars.clone();
+      out_track_parameters->push_back(out_pars);
+      out.addToTrackParameters(out_pars);
+    }
+    for (const auto& hit : trajectory.getMeasurementHits()) {
+      out.addToMeasurementHits(hit);
+    }
+    for (const auto& hit : trajectory.getOutlierHits()) {
+      out.addToOutlierHits(hit);
+    }
+
+    out_acts_trajectories.push_back(acts_trajectories[i]);
+  }
+
+  m_log->debug("Selected {} of {} tracks", out_trajectories->size(), trajectories.size());
+
+  return std::make_tuple(std::move(out_trajectories), std::move(out_track_parameters), std::move(out_acts_trajectories));
+}
+
+} // namespace eicrecon
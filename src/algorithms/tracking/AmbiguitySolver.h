@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <edm4eic/TrackParametersCollection.h>
+#include <edm4eic/TrajectoryCollection.h>
+#include <spdlog/logger.h>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "ActsExamples/EventData/Trajectories.hpp"
+#include "AmbiguitySolverConfig.h"
+#include "algorithms/interfaces/WithPodConfig.h"
+
+namespace eicrecon {
+
+/** Greedy shared-measurement ambiguity resolution of CKF tracks.
+ *
+ * Tracks with too few measurements, without degrees of freedom (ndf == 0)
+ * or with a too large chi2/ndf are dropped first. Then, as long as some
+ * track shares more than m_maxSharedHits measurements with the other
+ * remaining tracks, the track with the largest fraction of shared
+ * measurements is dropped, the one with the larger chi2/ndf on a tie, and
+ * the first one on a full tie. Only the sharing with tracks that are still
+ * selected counts, so the partners of a dropped duplicate are kept.
+ *
+ * The input trajectories and ACTS trajectories are expected in the same
+ * order, as produced by CKFTracking. The selected ACTS trajectories are
+ * returned as the input pointers, they are not copied and stay owned by
+ * their producer.
+ *
+ * \ingroup tracking
+ */
+class AmbiguitySolver : public WithPodConfig<AmbiguitySolverConfig> {
+public:
+  void init(std::shared_ptr<spdlog::logger> log);
+
+  std::tuple<
+      std::unique_ptr<edm4eic::TrajectoryCollection>,
+      std::unique_ptr<edm4eic::TrackParametersCollection>,
+      std::vector<const ActsExamples::Trajectories*>
+  >
+  process(const edm4eic::TrajectoryCollection& trajectories,
+          const std::vector<const ActsExamples::Trajectories*>& acts_trajectories);
+
+  /// Flags the selected tracks, given the measurement keys and the chi2/ndf of each track
+  std::vector<bool> select(const std::vector<std::vector<std::uint64_t>>& measurements,
+                           const std::vector<double>& chi2ndf) const;
+
+private:
+  std::shared_ptr<spdlog::logger> m_log;
+};
+
+} // namespace eicrecon
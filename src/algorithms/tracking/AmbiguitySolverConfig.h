@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+namespace eicrecon {
+
+struct AmbiguitySolverConfig {
+  /// Maximum number of measurements a track may share with other tracks
+  std::size_t m_maxSharedHits  = 1;
+  /// Maximum number of tracks removed for sharing measurements
+  std::size_t m_maxIterations  = 1000;
+  /// Tracks with fewer measurements are removed before resolving shared measurements
+  std::size_t m_minMeasurements = 3;
+  /// Tracks with a larger chi2/ndf are removed before resolving shared measurements
+  double m_maxChi2Ndf          = std::numeric_limits<double>::max();
+};
+
+} // namespace eicrecon
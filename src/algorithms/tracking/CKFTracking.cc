@@ -28,11 +28,12 @@
 #include <edm4hep/Vector2f.h>
 #include <fmt/core.h>
 #include <Eigen/Core>
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <exception>
 #include <functional>
-#include <list>
+#include <iterator>
 #include <optional>
 #include <string>
 #include <utility>
@@ -59,6 +60,9 @@ namespace eicrecon {
 
         m_geoSvc = geo_svc;
 
+        // threads for track finding within one event, started once
+        m_pool.resize(m_cfg.m_numThreads);
+
         m_BField = std::dynamic_pointer_cast<const eicrecon::BField::DD4hepBField>(m_geoSvc->getFieldProvider());
         m_fieldctx = eicrecon::BField::BFieldVariant(m_BField);
 
@@ -71,6 +75,9 @@ namespace eicrecon {
                 },
         };
         m_trackFinderFunc = CKFTracking::makeCKFTrackingFunction(m_geoSvc->trackingGeometry(), m_BField);
+
+        // Construct a perigee surface as the target surface
+        m_perigeeSurface = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3{0., 0., 0.});
     }
 
     std::tuple<
@@ -79,48 +86,13 @@ namespace eicrecon {
         std::vector<ActsExamples::Trajectories*>
     >
     CKFTracking::process(const edm4eic::Measurement2DCollection& meas2Ds,
+                         const TrackerSourceLinkerResult& source_links,
                          const edm4eic::TrackParametersCollection &init_trk_params) {
 
-
-        // create sourcelink and measurement containers
-        auto measurements = std::make_shared<ActsExamples::MeasurementContainer>();
-
-          // need list here for stable addresses
-        std::list<ActsExamples::IndexSourceLink> sourceLinkStorage;
-        ActsExamples::IndexSourceLinkContainer src_links;
-        src_links.reserve(meas2Ds.size());
-        std::size_t  hit_index = 0;
-
-
-        for (const auto& meas2D : meas2Ds) {
-
-            // --follow example from ACTS to create source links
-            sourceLinkStorage.emplace_back(meas2D.getSurface(), hit_index);
-            ActsExamples::IndexSourceLink& sourceLink = sourceLinkStorage.back();
-            // Add to output containers:
-            // index map and source link container are geometry-ordered.
-            // since the input is also geometry-ordered, new items can
-            // be added at the end.
-            src_links.insert(src_links.end(), sourceLink);
-            // ---
-            // Create ACTS measurements
-            Acts::Vector2 loc = Acts::Vector2::Zero();
-            loc[Acts::eBoundLoc0] = meas2D.getLoc().a;
-            loc[Acts::eBoundLoc1] = meas2D.getLoc().b;
-
-
-            Acts::SymMatrix2 cov = Acts::SymMatrix2::Zero();
-            cov(0, 0) = meas2D.getCovariance().xx;
-            cov(1, 1) = meas2D.getCovariance().yy;
-            cov(0, 1) = meas2D.getCovariance().xy;
-
-            auto measurement = Acts::makeMeasurement(sourceLink, loc, cov, Acts::eBoundLoc0, Acts::eBoundLoc1);
-            measurements->emplace_back(std::move(measurement));
-
-            hit_index++;
-        }
-
-        ActsExamples::TrackParametersContainer acts_init_trk_params;
+        // storage reused between events
+        auto& acts_init_trk_params = m_acts_init_trk_params;
+        acts_init_trk_params.clear();
+        acts_init_trk_params.reserve(init_trk_params.size());
         for (const auto& track_parameter: init_trk_params) {
 
             Acts::BoundVector params;
@@ -141,28 +113,26 @@ namespace eicrecon {
             cov(Acts::eBoundQOverP, Acts::eBoundQOverP) = std::pow( track_parameter.getMomentumError().zz,2) / (Acts::UnitConstants::GeV*Acts::UnitConstants::GeV);
             cov(Acts::eBoundTime, Acts::eBoundTime)     = std::pow( track_parameter.getTimeError(),2)*Acts::UnitConstants::ns*Acts::UnitConstants::ns;
 
-            // Construct a perigee surface as the target surface
-            auto pSurface = Acts::Surface::makeShared<const Acts::PerigeeSurface>(Acts::Vector3(0,0,0));
-
-            // Create parameters
-            acts_init_trk_params.emplace_back(pSurface, params, charge, cov);
+            // Create parameters, on the perigee surface shared by all seeds
+            acts_init_trk_params.emplace_back(m_perigeeSurface, params, charge, cov);
         }
 
         auto trajectories = std::make_unique<edm4eic::TrajectoryCollection>();
         auto track_parameters = std::make_unique<edm4eic::TrackParametersCollection>();
 
+        // the trajectories of the previous event are released, their objects are reused
+        for (auto& pooled : m_acts_trajectory_pool) {
+            pooled = ActsExamples::Trajectories();
+        }
         std::vector<ActsExamples::Trajectories*> acts_trajectories;
         acts_trajectories.reserve(init_trk_params.size());
 
-        //// Construct a perigee surface as the target surface
-        auto pSurface = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3{0., 0., 0.});
-
         ACTS_LOCAL_LOGGER(eicrecon::getSpdlogLogger(m_log, {"^No tracks found$"}));
 
         Acts::PropagatorPlainOptions pOptions;
         pOptions.maxSteps = 10000;
 
-        ActsExamples::MeasurementCalibrator calibrator{*measurements};
+        ActsExamples::MeasurementCalibrator calibrator{source_links.measurements};
         Acts::GainMatrixUpdater kfUpdater;
         Acts::GainMatrixSmoother kfSmoother;
         Acts::MeasurementSelector measSel{m_sourcelinkSelectorCfg};
@@ -181,7 +151,7 @@ namespace eicrecon {
                 &measSel);
 
         ActsExamples::IndexSourceLinkAccessor slAccessor;
-        slAccessor.container = &src_links;
+        slAccessor.container = &source_links.sourceLinks;
         Acts::SourceLinkAccessorDelegate<ActsExamples::IndexSourceLinkAccessor::Iterator>
                 slAccessorDelegate;
         slAccessorDelegate.connect<&ActsExamples::IndexSourceLinkAccessor::range>(&slAccessor);
@@ -189,9 +159,14 @@ namespace eicrecon {
         // Set the CombinatorialKalmanFilter options
         CKFTracking::TrackFinderOptions options(
                 m_geoctx, m_fieldctx, m_calibctx, slAccessorDelegate,
-                extensions, Acts::LoggerWrapper{logger()}, pOptions, &(*pSurface));
+                extensions, Acts::LoggerWrapper{logger()}, pOptions, m_perigeeSurface.get());
 
-        auto results = (*m_trackFinderFunc)(acts_init_trk_params, options);
+        TrackFinderResult results;
+        if (m_cfg.m_numThreads > 1 && m_cfg.m_seedBatchSize > 0 && acts_init_trk_params.size() > m_cfg.m_seedBatchSize) {
+            results = findTracksParallel(acts_init_trk_params, options);
+        } else {
+            results = (*m_trackFinderFunc)(acts_init_trk_params, options);
+        }
 
         for (std::size_t iseed = 0; iseed < acts_init_trk_params.size(); ++iseed) {
 
@@ -202,8 +177,12 @@ namespace eicrecon {
                 // Get the track finding output object
                 auto &trackFindingOutput = result.value();
 
-                // Create a SimMultiTrajectory
-                auto* multiTrajectory = new ActsExamples::Trajectories(
+                // Create a SimMultiTrajectory, in the next free object of the pool
+                if (acts_trajectories.size() == m_acts_trajectory_pool.size()) {
+                    m_acts_trajectory_pool.emplace_back();
+                }
+                auto* multiTrajectory = &m_acts_trajectory_pool[acts_trajectories.size()];
+                *multiTrajectory = ActsExamples::Trajectories(
                     std::move(trackFindingOutput.fittedStates),
                     std::move(trackFindingOutput.lastMeasurementIndices),
                     std::move(trackFindingOutput.fittedParameters)
@@ -217,7 +196,7 @@ namespace eicrecon {
 
                 if (trackTips.empty()) {
                     m_log->debug("Empty multiTrajectory.");
-                    delete multiTrajectory;
+                    *multiTrajectory = ActsExamples::Trajectories();
                     continue;
                 }
 
@@ -321,7 +300,7 @@ namespace eicrecon {
                     }
 
                 });
-                acts_trajectories.push_back(std::move(multiTrajectory));
+                acts_trajectories.push_back(multiTrajectory);
 
             }else {
 
@@ -334,4 +313,31 @@ namespace eicrecon {
         return std::make_tuple(std::move(trajectories), std::move(track_parameters), std::move(acts_trajectories));
     }
 
+    CKFTracking::TrackFinderResult CKFTracking::findTracksParallel(
+            const ActsExamples::TrackParametersContainer& init_trk_params,
+            const TrackFinderOptions& options) {
+
+        // Seeds are split in contiguous batches and the results are concatenated in batch
+        // order, so the output is the same as for serial track finding, for any number of
+        // threads. The track finder, the options and everything they refer to (geometry,
+        // field, calibrator, source links) are only read.
+        const std::size_t batch_size = m_cfg.m_seedBatchSize;
+        const std::size_t n_batches = (init_trk_params.size() + batch_size - 1) / batch_size;
+
+        std::vector<TrackFinderResult> batch_results(n_batches);
+        m_pool.run(n_batches, [&](std::size_t /* ithread */, std::size_t ibatch) {
+            const auto first = init_trk_params.begin() + ibatch * batch_size;
+            const auto last = init_trk_params.begin() + std::min((ibatch + 1) * batch_size, init_trk_params.size());
+            ActsExamples::TrackParametersContainer batch(first, last);
+            batch_results[ibatch] = (*m_trackFinderFunc)(batch, options);
+        });
+
+        TrackFinderResult results;
+        results.reserve(init_trk_params.size());
+        for (std::size_t ibatch = 0; ibatch < n_batches; ++ibatch) {
+            std::move(batch_results[ibatch].begin(), batch_results[ibatch].end(), std::back_inserter(results));
+        }
+        return results;
+    }
+
 } // namespace eicrecon
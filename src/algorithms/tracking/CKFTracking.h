@@ -8,6 +8,7 @@
 #include <Acts/Geometry/TrackingGeometry.hpp>
 #include <Acts/MagneticField/MagneticFieldContext.hpp>
 #include <Acts/MagneticField/MagneticFieldProvider.hpp>
+#include <Acts/Surfaces/PerigeeSurface.hpp>
 #include <Acts/TrackFinding/CombinatorialKalmanFilter.hpp>
 #include <Acts/TrackFinding/MeasurementSelector.hpp>
 #include <Acts/Utilities/CalibrationContext.hpp>
@@ -16,6 +17,7 @@
 #include <edm4eic/TrackParametersCollection.h>
 #include <edm4eic/TrajectoryCollection.h>
 #include <spdlog/logger.h>
+#include <deque>
 #include <memory>
 #include <tuple>
 #include <vector>
@@ -25,7 +27,9 @@
 #include "ActsExamples/EventData/Trajectories.hpp"
 #include "CKFTrackingConfig.h"
 #include "DD4hepBField.h"
+#include "TrackerSourceLinkerResult.h"
 #include "algorithms/interfaces/WithPodConfig.h"
+#include "algorithms/interfaces/WorkerPool.h"
 
 class ActsGeometryProvider;
 
@@ -68,15 +72,21 @@ namespace eicrecon {
 
         void init(std::shared_ptr<const ActsGeometryProvider> geo_svc, std::shared_ptr<spdlog::logger> log);
 
+        /// The ACTS trajectories stay owned by the algorithm, and are reused by the next call
         std::tuple<
             std::unique_ptr<edm4eic::TrajectoryCollection>,
             std::unique_ptr<edm4eic::TrackParametersCollection>,
             std::vector<ActsExamples::Trajectories*>
         >
         process(const edm4eic::Measurement2DCollection& meas2Ds,
+                const TrackerSourceLinkerResult& source_links,
                 const edm4eic::TrackParametersCollection &init_trk_params);
 
     private:
+        /// Runs the track finder over batches of seeds on several threads, in seed order
+        TrackFinderResult findTracksParallel(const ActsExamples::TrackParametersContainer& init_trk_params,
+                                             const TrackFinderOptions& options);
+
         std::shared_ptr<spdlog::logger> m_log;
         std::shared_ptr<CKFTrackingFunction> m_trackFinderFunc;
         std::shared_ptr<const ActsGeometryProvider> m_geoSvc;
@@ -87,6 +97,19 @@ namespace eicrecon {
         Acts::MagneticFieldContext m_fieldctx;
 
         Acts::MeasurementSelector::Config m_sourcelinkSelectorCfg;
+
+        /// Perigee surface at the origin, the surface of the seeds and the target surface of track finding
+        std::shared_ptr<const Acts::PerigeeSurface> m_perigeeSurface;
+
+        /// Threads for track finding within one event, see m_numThreads
+        WorkerPool m_pool;
+
+        /// Seeds of the current event, storage is reused between events
+        ActsExamples::TrackParametersContainer m_acts_init_trk_params;
+
+        /// Trajectories returned by process(), valid until the next call; a deque, so that
+        /// the objects do not move when it grows
+        std::deque<ActsExamples::Trajectories> m_acts_trajectory_pool;
     };
 
 } // namespace eicrecon::Reco
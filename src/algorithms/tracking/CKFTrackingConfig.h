@@ -11,5 +11,7 @@ namespace eicrecon {
         std::vector<double> m_etaBins = {};  // {this, "etaBins", {}};
         std::vector<double> m_chi2CutOff = {15.}; //{this, "chi2CutOff", {15.}};
         std::vector<size_t> m_numMeasurementsCutOff = {10}; //{this, "numMeasurementsCutOff", {10}};
+        size_t m_numThreads = 1;     // threads for track finding within one event, 1 is serial
+        size_t m_seedBatchSize = 16; // seeds per task when track finding runs on several threads
     };
 }
@@ -10,18 +10,138 @@
 #include <Evaluator/DD4hepUnits.h>
 #include <Math/GenVector/DisplacementVector3D.h>
 #include <Eigen/Core>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <thread>
 
 namespace eicrecon::BField {
 
-  Acts::Result<Acts::Vector3> DD4hepBField::getField(const Acts::Vector3& position,
-                                                     Acts::MagneticFieldProvider::Cache& /*cache*/) const
+  DD4hepBField::DD4hepBField(gsl::not_null<const dd4hep::Detector*> det, const GridConfig& grid)
+  : m_det(det), m_gridConfig(grid)
+  {
+    for (std::size_t d = 0; d < 3; ++d) {
+      if (!(grid.step[d] > 0.) || !(grid.max[d] > grid.min[d])) {
+        throw std::runtime_error("DD4hepBField: field grid needs a positive step and max > min in every dimension");
+      }
+      m_gridSize[d] = static_cast<std::int64_t>(std::ceil((grid.max[d] - grid.min[d]) / grid.step[d])) + 1;
+    }
+    m_grid.resize(static_cast<std::size_t>(m_gridSize[0]) * m_gridSize[1] * m_gridSize[2]);
+
+    // the DD4hep field is safe to evaluate concurrently, fill x slices in parallel
+    std::atomic<std::int64_t> next_ix{0};
+    auto fill = [this, &next_ix]() {
+      for (std::int64_t ix = next_ix++; ix < m_gridSize[0]; ix = next_ix++) {
+        for (std::int64_t iy = 0; iy < m_gridSize[1]; ++iy) {
+          for (std::int64_t iz = 0; iz < m_gridSize[2]; ++iz) {
+            const Acts::Vector3 position{
+              m_gridConfig.min[0] + ix * m_gridConfig.step[0],
+              m_gridConfig.min[1] + iy * m_gridConfig.step[1],
+              m_gridConfig.min[2] + iz * m_gridConfig.step[2]
+            };
+            const Acts::Vector3 field = exactField(position);
+            m_grid[gridIndex(ix, iy, iz)] = {
+              static_cast<float>(field.x()), static_cast<float>(field.y()), static_cast<float>(field.z())
+            };
+          }
+        }
+      }
+    };
+    std::vector<std::thread> workers(std::max(1U, std::thread::hardware_concurrency()));
+    for (auto& worker : workers) {
+      worker = std::thread(fill);
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+
+  Acts::Vector3 DD4hepBField::exactField(const Acts::Vector3& position) const
   {
     dd4hep::Position pos(position[0]/10.0,position[1]/10.0,position[2]/10.0); // FIXME
     auto fieldObj = m_det->field();
 
 
     auto field = fieldObj.magneticField(pos) * (Acts::UnitConstants::T / dd4hep::tesla);
-    return Acts::Result<Acts::Vector3>::success({field.x(), field.y(),field.z()});
+    return {field.x(), field.y(), field.z()};
+  }
+
+  bool DD4hepBField::insideGrid(const Acts::Vector3& position) const
+  {
+    for (std::size_t d = 0; d < 3; ++d) {
+      const double last = m_gridConfig.min[d] + (m_gridSize[d] - 1) * m_gridConfig.step[d];
+      // written so that NaN is outside
+      if (!(position[d] >= m_gridConfig.min[d] && position[d] <= last)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  Acts::Vector3 DD4hepBField::interpolate(const Acts::Vector3& position, Cache& cache) const
+  {
+    std::array<std::int64_t, 3> cell;
+    std::array<double, 3> frac;
+    for (std::size_t d = 0; d < 3; ++d) {
+      const double u = (position[d] - m_gridConfig.min[d]) / m_gridConfig.step[d];
+      cell[d] = std::clamp<std::int64_t>(static_cast<std::int64_t>(std::floor(u)), 0, m_gridSize[d] - 2);
+      frac[d] = u - cell[d];
+    }
+
+    // steppers evaluate the field at nearby points, usually within the same cell
+    if (cell != cache.cell) {
+      for (std::size_t c = 0; c < 8; ++c) {
+        const auto& b = m_grid[gridIndex(cell[0] + ((c >> 2) & 1), cell[1] + ((c >> 1) & 1), cell[2] + (c & 1))];
+        cache.corners[c] = {b[0], b[1], b[2]};
+      }
+      cache.cell = cell;
+    }
+
+    const auto& k = cache.corners;
+    auto lerp = [](const Acts::Vector3& a, const Acts::Vector3& b, double t) -> Acts::Vector3 { return a + t * (b - a); };
+    const Acts::Vector3 c00 = lerp(k[0], k[4], frac[0]);
+    const Acts::Vector3 c01 = lerp(k[1], k[5], frac[0]);
+    const Acts::Vector3 c10 = lerp(k[2], k[6], frac[0]);
+    const Acts::Vector3 c11 = lerp(k[3], k[7], frac[0]);
+    return lerp(lerp(c00, c10, frac[1]), lerp(c01, c11, frac[1]), frac[2]);
+  }
+
+  DD4hepBField::GridValidation DD4hepBField::validateGrid(std::size_t samples) const
+  {
+    GridValidation result;
+    if (!hasGrid()) {
+      return result;
+    }
+
+    // fixed seed, so that the report is reproducible
+    std::mt19937_64 rng(1);
+    std::array<std::uniform_real_distribution<double>, 3> uniform{{
+      std::uniform_real_distribution<double>(m_gridConfig.min[0], m_gridConfig.max[0]),
+      std::uniform_real_distribution<double>(m_gridConfig.min[1], m_gridConfig.max[1]),
+      std::uniform_real_distribution<double>(m_gridConfig.min[2], m_gridConfig.max[2])
+    }};
+    Cache cache{Acts::MagneticFieldContext{}};
+    for (std::size_t i = 0; i < samples; ++i) {
+      const Acts::Vector3 position{uniform[0](rng), uniform[1](rng), uniform[2](rng)};
+      const double deviation = (interpolate(position, cache) - exactField(position)).norm();
+      if (result.samples == 0 || deviation > result.maxDeviation) {
+        result.maxDeviation = deviation;
+        result.position = position;
+      }
+      ++result.samples;
+    }
+    return result;
+  }
+
+  Acts::Result<Acts::Vector3> DD4hepBField::getField(const Acts::Vector3& position,
+                                                     Acts::MagneticFieldProvider::Cache& cache) const
+  {
+    if (hasGrid() && insideGrid(position)) {
+      return Acts::Result<Acts::Vector3>::success(interpolate(position, cache.as<Cache>()));
+    }
+    return Acts::Result<Acts::Vector3>::success(exactField(position));
   }
 
   Acts::Result<Acts::Vector3> DD4hepBField::getFieldGradient(const Acts::Vector3& position,
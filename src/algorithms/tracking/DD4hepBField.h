@@ -14,8 +14,12 @@
 #include <Acts/Utilities/Result.hpp>
 #include <DD4hep/Detector.h>
 #include <gsl/pointers>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <variant>
+#include <vector>
 
 
 
@@ -37,8 +41,26 @@ namespace eicrecon::BField {
       gsl::not_null<const dd4hep::Detector*> m_det;
 
   public:
+    /// Regular grid on which the field is precomputed, in mm
+    struct GridConfig {
+      std::array<double, 3> min{-1000., -1000., -2000.};
+      std::array<double, 3> max{1000., 1000., 4000.};
+      std::array<double, 3> step{20., 20., 20.};
+    };
+
+    /// Largest difference between the interpolated and the exact field over random points in the grid
+    struct GridValidation {
+      std::size_t samples{0};
+      double maxDeviation{0.};
+      Acts::Vector3 position{0., 0., 0.};
+    };
+
     struct Cache {
       Cache(const Acts::MagneticFieldContext& /*mcfg*/) { }
+
+      /// Grid cell of the last lookup, and the field at its corners
+      std::array<std::int64_t, 3> cell{-1, -1, -1};
+      std::array<Acts::Vector3, 8> corners;
     };
 
     Acts::MagneticFieldProvider::Cache makeCache(const Acts::MagneticFieldContext& mctx) const override
@@ -52,10 +74,28 @@ namespace eicrecon::BField {
     */
     explicit DD4hepBField(gsl::not_null<const dd4hep::Detector*> det) : m_det(det) {}
 
+    /** construct the field from a precomputed grid.
+    *
+    * Inside the grid the field is interpolated trilinearly, outside of it
+    * the DD4hep field is evaluated directly.
+    *
+    * @param [in] DD4hep detector instance
+    * @param [in] grid extent and granularity of the grid
+    */
+    DD4hepBField(gsl::not_null<const dd4hep::Detector*> det, const GridConfig& grid);
+
+    bool hasGrid() const { return !m_grid.empty(); }
+
+    /// Field evaluated directly from DD4hep, bypassing the grid
+    Acts::Vector3 exactField(const Acts::Vector3& position) const;
+
+    /// Compare the interpolated to the exact field at random points inside the grid
+    GridValidation validateGrid(std::size_t samples) const;
+
     /**  retrieve magnetic field value.
      *
      *  @param [in] position global position
-     *  @param [in] cache Cache object (is ignored)
+     *  @param [in] cache Cache object, holds the last grid cell used
      *  @return magnetic field vector
      *
      *  @note The @p position is ignored and only kept as argument to provide
@@ -68,7 +108,7 @@ namespace eicrecon::BField {
      * @param [in]  position   global position
      * @param [out] derivative gradient of magnetic field vector as (3x3)
      * matrix
-     * @param [in] cache Cache object (is ignored)
+     * @param [in] cache Cache object, holds the last grid cell used
      * @return magnetic field vector
      *
      * @note The @p position is ignored and only kept as argument to provide
@@ -78,6 +118,19 @@ namespace eicrecon::BField {
      */
     Acts::Result<Acts::Vector3> getFieldGradient(const Acts::Vector3& position, Acts::ActsMatrix<3, 3>& /*derivative*/,
                                                  Acts::MagneticFieldProvider::Cache& cache) const override;
+
+  private:
+    bool insideGrid(const Acts::Vector3& position) const;
+    Acts::Vector3 interpolate(const Acts::Vector3& position, Cache& cache) const;
+
+    std::size_t gridIndex(std::int64_t ix, std::int64_t iy, std::int64_t iz) const {
+      return (static_cast<std::size_t>(ix) * m_gridSize[1] + iy) * m_gridSize[2] + iz;
+    }
+
+    GridConfig m_gridConfig;
+    std::array<std::int64_t, 3> m_gridSize{0, 0, 0};
+    /// Field at the grid points in single precision, x-major
+    std::vector<std::array<float, 3>> m_grid;
   };
 
   using BFieldVariant = std::variant<std::shared_ptr<const DD4hepBField>>;
@@ -9,7 +9,6 @@
 #include <Acts/MagneticField/MagneticFieldContext.hpp>
 #include <Acts/Propagator/EigenStepper.hpp>
 #include <Acts/Propagator/Propagator.hpp>
-#include <Acts/Utilities/Logger.hpp>
 #include <Acts/Utilities/Result.hpp>
 #include <Acts/Vertexing/FullBilloirVertexFitter.hpp>
 #include <Acts/Vertexing/HelicalTrackLinearizer.hpp>
@@ -20,10 +19,53 @@
 #include <Acts/Vertexing/ZScanVertexFinder.hpp>
 #include <edm4eic/Cov3f.h>
 #include <Eigen/Core>
+#include <chrono>
+#include <memory>
 #include <utility>
 #include <variant>
 
-#include "extensions/spdlog/SpdlogToActs.h"
+namespace eicrecon {
+
+using Propagator           = Acts::Propagator<Acts::EigenStepper<>>;
+using Linearizer           = Acts::HelicalTrackLinearizer<Propagator>;
+using VertexFitter         = Acts::FullBilloirVertexFitter<Acts::BoundTrackParameters, Linearizer>;
+using ImpactPointEstimator = Acts::ImpactPointEstimator<Acts::BoundTrackParameters, Propagator>;
+using VertexSeeder         = Acts::ZScanVertexFinder<VertexFitter>;
+using VertexFinder         = Acts::IterativeVertexFinder<VertexFitter, VertexSeeder>;
+using VertexFinderOptions  = Acts::VertexingOptions<Acts::BoundTrackParameters>;
+
+struct IterativeVertexFinder::Finder {
+  // members are initialized in order, the finder copies the components before it
+  std::shared_ptr<Propagator> propagator;
+  VertexFitter vertexFitter;
+  Linearizer linearizer;
+  ImpactPointEstimator ipEst;
+  VertexFinder finder;
+
+  Finder(const std::shared_ptr<const eicrecon::BField::DD4hepBField>& bfield, const IterativeVertexFinderConfig& cfg)
+      : propagator(std::make_shared<Propagator>(Acts::EigenStepper<>(bfield)))
+      , vertexFitter(VertexFitter::Config())
+      , linearizer(Linearizer::Config(bfield, propagator))
+      , ipEst(ImpactPointEstimator::Config(bfield, propagator))
+      , finder(finderConfig(cfg)) {}
+
+  VertexFinder::Config finderConfig(const IterativeVertexFinderConfig& cfg) const {
+    // Setup the seed finder
+    VertexSeeder::Config seederCfg(ipEst);
+    VertexSeeder seeder(seederCfg);
+    // Set up the actual vertex finder
+    VertexFinder::Config finderCfg(vertexFitter, linearizer, std::move(seeder), ipEst);
+    finderCfg.maxVertices                 = cfg.m_maxVertices;
+    finderCfg.reassignTracksAfterFirstFit = cfg.m_reassignTracksAfterFirstFit;
+    return finderCfg;
+  }
+};
+
+} // namespace eicrecon
+
+eicrecon::IterativeVertexFinder::IterativeVertexFinder() = default;
+
+eicrecon::IterativeVertexFinder::~IterativeVertexFinder() = default;
 
 void eicrecon::IterativeVertexFinder::init(std::shared_ptr<const ActsGeometryProvider> geo_svc,
                                            std::shared_ptr<spdlog::logger> log) {
@@ -35,44 +77,18 @@ void eicrecon::IterativeVertexFinder::init(std::shared_ptr<const ActsGeometryPro
   m_BField =
       std::dynamic_pointer_cast<const eicrecon::BField::DD4hepBField>(m_geoSvc->getFieldProvider());
   m_fieldctx = eicrecon::BField::BFieldVariant(m_BField);
+
+  m_finder = std::make_unique<Finder>(m_BField, m_cfg);
 }
 
 std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::produce(
     std::vector<const ActsExamples::Trajectories*> trajectories) {
 
+  const auto start = std::chrono::steady_clock::now();
+
   auto outputVertices = std::make_unique<edm4eic::VertexCollection>();
 
-  using Propagator        = Acts::Propagator<Acts::EigenStepper<>>;
-  using PropagatorOptions = Acts::PropagatorOptions<>;
-  using Linearizer        = Acts::HelicalTrackLinearizer<Propagator>;
-  using VertexFitter      = Acts::FullBilloirVertexFitter<Acts::BoundTrackParameters, Linearizer>;
-  using ImpactPointEstimator = Acts::ImpactPointEstimator<Acts::BoundTrackParameters, Propagator>;
-  using VertexSeeder         = Acts::ZScanVertexFinder<VertexFitter>;
-  using VertexFinder         = Acts::IterativeVertexFinder<VertexFitter, VertexSeeder>;
-  using VertexFinderOptions  = Acts::VertexingOptions<Acts::BoundTrackParameters>;
-
-  Acts::EigenStepper<> stepper(m_BField);
-  auto propagator = std::make_shared<Propagator>(stepper);
-
-  ACTS_LOCAL_LOGGER(eicrecon::getSpdlogLogger(m_log));
-  Acts::PropagatorOptions opts(m_geoctx, m_fieldctx, Acts::LoggerWrapper{logger()});
-
-  // Setup the vertex fitter
-  VertexFitter::Config vertexFitterCfg;
-  VertexFitter vertexFitter(vertexFitterCfg);
-  // Setup the track linearizer
-  Linearizer::Config linearizerCfg(m_BField, propagator);
-  Linearizer linearizer(linearizerCfg);
-  // Setup the seed finder
-  ImpactPointEstimator::Config ipEstCfg(m_BField, propagator);
-  ImpactPointEstimator ipEst(ipEstCfg);
-  VertexSeeder::Config seederCfg(ipEst);
-  VertexSeeder seeder(seederCfg);
-  // Set up the actual vertex finder
-  VertexFinder::Config finderCfg(vertexFitter, linearizer, std::move(seeder), ipEst);
-  finderCfg.maxVertices                 = m_cfg.m_maxVertices;
-  finderCfg.reassignTracksAfterFirstFit = m_cfg.m_reassignTracksAfterFirstFit;
-  VertexFinder finder(finderCfg);
+  // per-event caches of the field and the impact point estimator
   VertexFinder::State state(*m_BField, m_fieldctx);
   VertexFinderOptions finderOpts(m_geoctx, m_fieldctx);
 
@@ -90,7 +106,7 @@ std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::prod
   }
 
   std::vector<Acts::Vertex<Acts::BoundTrackParameters>> vertices;
-  auto result = finder.find(inputTrackPointers, finderOpts, state);
+  auto result = m_finder->finder.find(inputTrackPointers, finderOpts, state);
   if (result.ok()) {
     vertices = std::move(result.value());
   }
@@ -113,5 +129,8 @@ std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::prod
     eicvertex.setTime((float)vtx.time());                     // time
   }
 
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  m_log->debug("Found {} vertices from {} tracks in {:.3f} ms", outputVertices->size(), inputTrackPointers.size(), elapsed.count());
+
   return std::move(outputVertices);
 }
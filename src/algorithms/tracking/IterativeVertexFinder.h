@@ -21,18 +21,24 @@ namespace eicrecon {
 class IterativeVertexFinder
     : public eicrecon::WithPodConfig<eicrecon::IterativeVertexFinderConfig> {
 public:
+  IterativeVertexFinder();
+  ~IterativeVertexFinder();
+
   void init(std::shared_ptr<const ActsGeometryProvider> geo_svc,
             std::shared_ptr<spdlog::logger> log);
   std::unique_ptr<edm4eic::VertexCollection>
   produce(std::vector<const ActsExamples::Trajectories*> trajectories);
 
 private:
+  /// ACTS vertex finder and its fitter, linearizer, seeder and propagator, built once in init()
+  struct Finder;
+  std::unique_ptr<Finder> m_finder;
+
   std::shared_ptr<spdlog::logger> m_log;
   std::shared_ptr<const ActsGeometryProvider> m_geoSvc;
 
   std::shared_ptr<const eicrecon::BField::DD4hepBField> m_BField = nullptr;
   Acts::GeometryContext m_geoctx;
   Acts::MagneticFieldContext m_fieldctx;
-  IterativeVertexFinderConfig m_cfg;
 };
 } // namespace eicrecon
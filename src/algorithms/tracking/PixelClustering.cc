@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Shujie Li
+
+#include "PixelClustering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+
+namespace eicrecon {
+
+    void PixelClustering::cluster(const std::vector<PixelHit>& hits, std::vector<PixelCluster>& clusters) {
+        clusters.clear();
+
+        const std::size_t n_hits = hits.size();
+        m_order.resize(n_hits);
+        std::iota(m_order.begin(), m_order.end(), 0);
+        m_rank.resize(n_hits);
+        m_window.assign(n_hits, 0.);
+
+        if (m_cfg.m_clustering) {
+            // sweep along loc0 within each sensor, adjacent pixels are at most 1.5 pitches apart
+            std::sort(m_order.begin(), m_order.end(), [&hits](std::size_t a, std::size_t b) {
+                const auto& ha = hits[a];
+                const auto& hb = hits[b];
+                if (ha.vol_id != hb.vol_id) {
+                    return ha.vol_id < hb.vol_id;
+                }
+                return ha.loc[0] < hb.loc[0];
+            });
+            for (std::size_t k = 0; k < n_hits; ++k) {
+                m_rank[m_order[k]] = k;
+            }
+
+            // one window per sensor, from its largest pitch, so that the candidates are symmetric
+            for (std::size_t first = 0, last = 0; first < n_hits; first = last) {
+                const auto vol_id = hits[m_order[first]].vol_id;
+                double window = 0.;
+                for (last = first; last < n_hits && hits[m_order[last]].vol_id == vol_id; ++last) {
+                    window = std::max(window, 1.5 * std::sqrt(12. * hits[m_order[last]].cov(0, 0)));
+                }
+                for (std::size_t k = first; k < last; ++k) {
+                    m_window[m_order[k]] = window;
+                }
+            }
+        }
+
+        m_components.compute(
+            n_hits,
+            [](std::size_t) { return true; },
+            [&](std::size_t i, auto&& visit) {
+                if (!m_cfg.m_clustering || !hits[i].clustering) {
+                    return;
+                }
+                const auto& hi = hits[i];
+                auto in_window = [&](std::size_t k) {
+                    const auto& hk = hits[m_order[k]];
+                    return hk.vol_id == hi.vol_id && std::abs(hk.loc[0] - hi.loc[0]) <= m_window[i];
+                };
+                for (std::size_t k = m_rank[i] + 1; k < n_hits && in_window(k); ++k) {
+                    visit(m_order[k]);
+                }
+                for (std::size_t k = m_rank[i]; k-- > 0 && in_window(k);) {
+                    visit(m_order[k]);
+                }
+            },
+            [&hits](std::size_t i, std::size_t j) {
+                return hits[i].clustering && hits[j].clustering && adjacent(hits[i], hits[j]);
+            });
+
+        // clusters ordered by their first hit, hits in input order within a cluster
+        m_components.collect();
+        for (std::size_t k = 0; k < m_components.size(); ++k) {
+            const auto group = m_components[k];
+
+            if (group.size() < m_cfg.m_minClusterSize) {
+                // rejected, below the minimum size
+            } else if (group.size() > m_cfg.m_maxClusterSize) {
+                // above the maximum size, its hits are kept as separate clusters
+                for (const auto* it = group.begin(); it != group.end(); ++it) {
+                    addCluster(hits, it, it + 1, clusters);
+                }
+            } else {
+                addCluster(hits, group.begin(), group.end(), clusters);
+            }
+        }
+    }
+
+
+    bool PixelClustering::adjacent(const PixelHit& a, const PixelHit& b) {
+        // pixels sharing an edge or a corner have centers one pitch apart along each axis
+        for (int i = 0; i < 2; ++i) {
+            const double pitch = std::sqrt(12. * std::max(a.cov(i, i), b.cov(i, i)));
+            if (!(std::abs(a.loc[i] - b.loc[i]) < 1.5 * pitch)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    void PixelClustering::addCluster(const std::vector<PixelHit>& hits,
+                                     const std::size_t* begin,
+                                     const std::size_t* end,
+                                     std::vector<PixelCluster>& clusters) {
+        // charge weights, hits without deposited energy count equally
+        double total_edep = 0;
+        for (auto it = begin; it != end; ++it) {
+            total_edep += std::max(0., hits[*it].edep);
+        }
+        const auto n = static_cast<double>(std::distance(begin, end));
+
+        auto& cluster = clusters.emplace_back();
+        cluster.loc = Acts::Vector2::Zero();
+        cluster.time = 0;
+        double sigma0 = 0;
+        double sigma1 = 0;
+        double time_var = 0;
+        for (auto it = begin; it != end; ++it) {
+            const auto& hit = hits[*it];
+            const double w = (total_edep > 0) ? std::max(0., hit.edep) / total_edep : 1. / n;
+            cluster.hits.push_back(*it);
+            cluster.weights.push_back(w);
+
+            // weighted mean of the positions, whose errors are fully correlated
+            cluster.loc += w * hit.loc;
+            sigma0 += w * std::sqrt(hit.cov(0, 0));
+            sigma1 += w * std::sqrt(hit.cov(1, 1));
+
+            // weighted mean of the times, whose errors are independent
+            cluster.time += w * hit.time;
+            time_var += w * w * hit.time_error * hit.time_error;
+        }
+        cluster.cov = Acts::SymMatrix2::Zero();
+        cluster.cov(0, 0) = sigma0 * sigma0;
+        cluster.cov(1, 1) = sigma1 * sigma1;
+        cluster.time_error = std::sqrt(time_var);
+    }
+
+} // namespace eicrecon
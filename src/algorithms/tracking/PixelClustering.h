@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Shujie Li
+
+#pragma once
+
+#include <Acts/Definitions/Algebra.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "TrackerMeasurementFromHitsConfig.h"
+#include "algorithms/calorimetry/ConnectedComponents.h"
+#include "algorithms/interfaces/WithPodConfig.h"
+
+namespace eicrecon {
+
+    /// A pixel hit in the local coordinates of its sensor
+    struct PixelHit {
+        std::uint64_t vol_id;    // sensor volume
+        Acts::Vector2 loc;       // local position
+        Acts::SymMatrix2 cov;    // local position covariance, pitch^2/12 along each axis
+        double edep;
+        double time;
+        double time_error;
+        bool clustering = true;  // may be merged with hits in adjacent pixels
+    };
+
+    /// A group of hits which becomes one measurement
+    struct PixelCluster {
+        std::vector<std::size_t> hits; // indices of the hits
+        std::vector<double> weights;    // weight of each hit, mirrors hits
+        Acts::Vector2 loc;
+        Acts::SymMatrix2 cov;
+        double time;
+        double time_error;
+    };
+
+    /** Groups hits in adjacent pixels of the same sensor (sharing an edge or a corner).
+     *
+     * Only hits flagged for clustering are merged, the others each form a cluster.
+     *
+     * The pitch is taken from the hit position variance. Each cluster is at the
+     * charge-weighted mean of the local positions of its hits. All hits of a cluster
+     * come from the same track crossing, so their pixel quantization errors are fully
+     * correlated and the cluster has the (weighted) position error of a single pixel,
+     * rather than one that shrinks with the number of hits.
+     */
+    class PixelClustering : public WithPodConfig<TrackerMeasurementFromHitsConfig> {
+    public:
+        /// Fills `clusters` with the clusters of `hits`, ordered by their first hit
+        void cluster(const std::vector<PixelHit>& hits, std::vector<PixelCluster>& clusters);
+
+        /// Whether two hits on the same sensor are in adjacent pixels
+        static bool adjacent(const PixelHit& a, const PixelHit& b);
+
+    private:
+        /// Adds one cluster from the hits hits[*it] for it in [begin, end)
+        static void addCluster(const std::vector<PixelHit>& hits,
+                               const std::size_t* begin,
+                               const std::size_t* end,
+                               std::vector<PixelCluster>& clusters);
+
+        ConnectedComponents m_components;
+
+        // scratch space reused between events
+        std::vector<std::size_t> m_order;   // hits sorted by sensor and loc0
+        std::vector<std::size_t> m_rank;    // position of each hit in m_order
+        std::vector<double> m_window;       // loc0 distance within which a hit has neighbours
+    };
+
+}
@@ -0,0 +1,209 @@
+// Created by Dmitry Romanov
+// Subject to the terms in the LICENSE file found in the top-level directory.
+//
+
+#include "SeedBatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+void eicrecon::SeedBatch::resize(std::size_t n)
+{
+  size = n;
+  for (std::size_t k = 0; k < kHits; ++k) {
+    x[k].resize(n);
+    y[k].resize(n);
+    r[k].resize(n);
+    z[k].resize(n);
+  }
+  for (auto* v : {&hitVariance, &R, &X0, &Y0, &slope, &intercept, &varSlope, &varIntercept, &covSlopeIntercept}) {
+    v->resize(n);
+  }
+}
+
+ /**
+   * Circle fit to a given set of data points (in 2D)
+   * This is an algebraic fit, due to Taubin, based on the journal article
+   * G. Taubin, "Estimation Of Planar Curves, Surfaces And Nonplanar
+   * Space Curves Defined By Implicit Equations, With
+   * Applications To Edge And Range Image Segmentation",
+   * IEEE Trans. PAMI, Vol. 13, pages 1115-1138, (1991)
+   * It works well whether data points are sampled along an entire circle or along a small arc.
+   * It still has a small bias and its statistical accuracy is slightly lower than that of the geometric fit (minimizing geometric distances),
+   * It provides a very good initial guess for a subsequent geometric fit.
+   * Nikolai Chernov  (September 2012)
+   *
+   * Seeds are fitted in blocks of kBlock. The Newton iterations of a seed
+   * stop (as a masked no-op) at the same point as in the fit of a single seed.
+   */
+void eicrecon::SeedBatch::fitCircles()
+{
+  auto& b = *this;
+  constexpr double weight = kHits;
+
+  for (std::size_t start = 0; start < b.size; start += kBlock) {
+    const std::size_t m = std::min(kBlock, b.size - start);
+
+    // Per-block intermediate results on the stack, which cannot alias the hit arrays, so
+    // the loops over the seeds of a block vectorize without run-time alias checks
+    double meanX[kBlock], meanY[kBlock];
+    double Mxx[kBlock], Myy[kBlock], Mxy[kBlock];
+    double Mxz[kBlock], Myz[kBlock], Mz[kBlock], Cov_xy[kBlock];
+    double A0[kBlock], A1[kBlock], A2[kBlock], A3[kBlock];
+    double root[kBlock], value[kBlock];
+    std::int64_t active[kBlock]; // as wide as the doubles, for the vectorized masks
+
+    for (std::size_t j = 0; j < m; ++j) {
+      const std::size_t i = start + j;
+      const double xs[kHits] = {b.x[0][i], b.x[1][i], b.x[2][i]};
+      const double ys[kHits] = {b.y[0][i], b.y[1][i], b.y[2][i]};
+
+      // Compute x- and y- sample means
+      const double mx = (xs[0] + xs[1] + xs[2]) / weight;
+      const double my = (ys[0] + ys[1] + ys[2]) / weight;
+
+      //     computing moments
+      double mxx = 0, myy = 0, mxy = 0, mxz = 0, myz = 0, mzz = 0;
+      for (std::size_t k = 0; k < kHits; ++k) {
+        const double Xi = xs[k] - mx;   //  centered x-coordinates
+        const double Yi = ys[k] - my;   //  centered y-coordinates
+        const double Zi = Xi*Xi + Yi*Yi;
+        mxy += Xi*Yi;
+        mxx += Xi*Xi;
+        myy += Yi*Yi;
+        mxz += Xi*Zi;
+        myz += Yi*Zi;
+        mzz += Zi*Zi;
+      }
+      mxx /= weight;
+      myy /= weight;
+      mxy /= weight;
+      mxz /= weight;
+      myz /= weight;
+      mzz /= weight;
+
+      //  computing coefficients of the characteristic polynomial
+      const double mz = mxx + myy;
+      const double cov_xy = mxx*myy - mxy*mxy;
+      const double var_z = mzz - mz*mz;
+      A3[j] = 4*mz;
+      A2[j] = -3*mz*mz - mzz;
+      A1[j] = var_z*mz + 4*cov_xy*mz - mxz*mxz - myz*myz;
+      A0[j] = mxz*(mxz*myy - myz*mxy) + myz*(myz*mxx - mxz*mxy) - var_z*cov_xy;
+
+      meanX[j] = mx;
+      meanY[j] = my;
+      Mxx[j] = mxx;
+      Myy[j] = myy;
+      Mxy[j] = mxy;
+      Mxz[j] = mxz;
+      Myz[j] = myz;
+      Mz[j] = mz;
+      Cov_xy[j] = cov_xy;
+
+      root[j] = 0;
+      value[j] = A0[j];
+      active[j] = 1;
+    }
+
+    //    finding the root of the characteristic polynomial
+    //    using Newton's method starting at x=0
+    //    (it is guaranteed to converge to the right root)
+    static constexpr int iter_max = 99;
+
+    // usually, 4-6 iterations are enough
+    for (int iter = 0; iter < iter_max; ++iter) {
+      std::int64_t any_active = 0;
+      for (std::size_t j = 0; j < m; ++j) {
+        const double x = root[j];
+        const double y = value[j];
+        const double Dy = A1[j] + x*(2*A2[j] + 3*A3[j]*x);
+        const double xnew = x - y/Dy;
+        const double ynew = A0[j] + xnew*(A1[j] + xnew*(A2[j] + xnew*A3[j]));
+        // stops where the fit of a single seed stops, without branches: after a converged,
+        // non-finite or diverging step, the seed is left unchanged
+        const std::int64_t step = active[j] & (xnew != x) & (std::abs(xnew) <= std::numeric_limits<double>::max())
+                                & (std::abs(ynew) < std::abs(y));
+        root[j] = step ? xnew : x;
+        value[j] = step ? ynew : y;
+        active[j] = step;
+        any_active |= step;
+      }
+      if (!any_active) {
+        break;
+      }
+    }
+
+    //  computing parameters of the fitting circle
+    double R2[kBlock];
+    for (std::size_t j = 0; j < m; ++j) {
+      const double x = root[j];
+      const double DET = x*x - x*Mz[j] + Cov_xy[j];
+      const double Xcenter = (Mxz[j]*(Myy[j] - x) - Myz[j]*Mxy[j])/DET/2;
+      const double Ycenter = (Myz[j]*(Mxx[j] - x) - Mxz[j]*Mxy[j])/DET/2;
+
+      //  assembling the output
+      b.X0[start + j] = Xcenter + meanX[j];
+      b.Y0[start + j] = Ycenter + meanY[j];
+      R2[j] = Xcenter*Xcenter + Ycenter*Ycenter + Mz[j];
+    }
+    for (std::size_t j = 0; j < m; ++j) {
+      b.R[start + j] = std::sqrt(R2[j]);
+    }
+  }
+}
+
+void eicrecon::SeedBatch::fitLines()
+{
+  auto& b = *this;
+  constexpr double npts = kHits;
+
+  for (std::size_t start = 0; start < b.size; start += kBlock) {
+    const std::size_t m = std::min(kBlock, b.size - start);
+
+    // results of the block on the stack, see fitCircles()
+    double slopes[kBlock], intercepts[kBlock];
+    double varSlope[kBlock], varIntercept[kBlock], covSlopeIntercept[kBlock];
+
+    for (std::size_t j = 0; j < m; ++j) {
+      const std::size_t i = start + j;
+      const double rs[kHits] = {b.r[0][i], b.r[1][i], b.r[2][i]};
+      const double zs[kHits] = {b.z[0][i], b.z[1][i], b.z[2][i]};
+      const double xmean = (rs[0] + rs[1] + rs[2]) / npts;
+      const double ymean = (zs[0] + zs[1] + zs[2]) / npts;
+
+      // least squares in centered coordinates
+      double Sxx = 0;
+      double Sxy = 0;
+      for (std::size_t k = 0; k < kHits; ++k) {
+        const double dx = rs[k] - xmean;
+        Sxx += dx*dx;
+        Sxy += dx*(zs[k] - ymean);
+      }
+      const double slope = Sxy / Sxx;
+      const double intercept = ymean - slope*xmean;
+
+      // residual variance (one degree of freedom for three hits), not below the hit resolution
+      double chi2 = 0;
+      for (std::size_t k = 0; k < kHits; ++k) {
+        const double res = zs[k] - (slope*rs[k] + intercept);
+        chi2 += res*res;
+      }
+      const double sigma2 = std::max(chi2 / (npts - 2), b.hitVariance[i]);
+
+      slopes[j] = slope;
+      intercepts[j] = intercept;
+      varSlope[j] = sigma2 / Sxx;
+      varIntercept[j] = sigma2 * (1./npts + xmean*xmean/Sxx);
+      covSlopeIntercept[j] = -sigma2 * xmean/Sxx;
+    }
+
+    std::copy_n(slopes, m, b.slope.begin() + start);
+    std::copy_n(intercepts, m, b.intercept.begin() + start);
+    std::copy_n(varSlope, m, b.varSlope.begin() + start);
+    std::copy_n(varIntercept, m, b.varIntercept.begin() + start);
+    std::copy_n(covSlopeIntercept, m, b.covSlopeIntercept.begin() + start);
+  }
+}
@@ -0,0 +1,42 @@
+// Created by Dmitry Romanov
+// Subject to the terms in the LICENSE file found in the top-level directory.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace eicrecon {
+
+    /** Hits and fit results of all seeds of an event, in structure-of-arrays layout.
+     *
+     * Every array has one entry per seed, so that each fit step is a loop over seeds
+     * without branches that the compiler can vectorize. Storage is reused between events.
+     */
+    struct SeedBatch {
+        static constexpr std::size_t kHits = 3;   // ACTS seeds are triplets
+        static constexpr std::size_t kBlock = 16; // seeds fitted together
+
+        std::size_t size = 0;
+
+        // hit coordinates, by hit index within the seed
+        std::array<std::vector<double>, kHits> x, y, r, z;
+        std::vector<double> hitVariance; // mean hit position variance [mm^2]
+
+        // circle fit in x-y
+        std::vector<double> R, X0, Y0;
+        // line fit in r-z, z = slope * r + intercept
+        std::vector<double> slope, intercept, varSlope, varIntercept, covSlopeIntercept;
+
+        void resize(std::size_t n);
+
+        /// Taubin circle fit of the x-y hit positions of every seed
+        void fitCircles();
+
+        /// Least squares line fit of the r-z hit positions of every seed, with its covariance
+        void fitLines();
+    };
+
+}
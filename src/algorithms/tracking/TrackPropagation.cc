@@ -40,6 +40,11 @@ namespace eicrecon {
                                 std::shared_ptr<spdlog::logger> logger) {
         m_geoSvc = geo_svc;
         m_log = logger;
+
+        Stepper stepper(m_geoSvc->getFieldProvider());
+        m_propagator = std::make_unique<const Propagator>(std::move(stepper));
+        m_actsLogger = eicrecon::getSpdlogLogger(m_log);
+
         m_log->trace("Initialized");
     }
 
@@ -105,17 +110,15 @@ namespace eicrecon {
         decltype(edm4eic::TrackSegmentData::length)      length       = 0;
         decltype(edm4eic::TrackSegmentData::lengthError) length_error = 0;
 
-        // loop over projection-target surfaces
-        for(const auto& targetSurf : targetSurfaces) {
+        // propagate along the projection-target surfaces, one after the other
+        std::vector<std::unique_ptr<edm4eic::TrackPoint>> points;
+        try {
+          points = propagateChain(traj, targetSurfaces);
+        } catch(std::exception &e) {
+          m_log->warn("<> Exception in TrackPropagation::propagateToSurfaceList: {}; skip this trajectory", e.what());
+        }
+        for(auto& point : points) {
 
-          // project the trajectory `traj` to this surface
-          std::unique_ptr<edm4eic::TrackPoint> point;
-          try {
-            point = propagate(traj, targetSurf);
-          } catch(std::exception &e) {
-            m_log->warn("<> Exception in TrackPropagation::propagateToSurfaceList: {}; skip this TrackPoint and surface", e.what());
-            continue;
-          }
           if(!point) {
             m_log->trace("<> Failed to propagate trajectory to this plane");
             continue;
@@ -161,8 +164,63 @@ namespace eicrecon {
 
 
 
+    std::vector<std::unique_ptr<edm4eic::TrackPoint>> TrackPropagation::propagateChain(const ActsExamples::Trajectories *traj,
+                                                                                      const std::vector<std::shared_ptr<Acts::Surface>> &targetSurfaces) {
+        std::vector<std::unique_ptr<edm4eic::TrackPoint>> points(targetSurfaces.size());
+
+        const auto *tip_parameters = tipParameters(traj);
+        if (tip_parameters == nullptr) {
+            return points;
+        }
+
+        // the last reached state, the next surface is propagated to from here
+        std::optional<Acts::BoundTrackParameters> current;
+        double current_path_length = 0;
+
+        for (std::size_t isurf = 0; isurf < targetSurfaces.size(); ++isurf) {
+            const auto& targetSurf = targetSurfaces[isurf];
+            m_log->trace("    TrackPropagation. Propagating to surface # {}", isurf);
+
+            std::optional<std::pair<Acts::BoundTrackParameters, double>> result;
+            try {
+                result = propagateTo(current ? *current : *tip_parameters, *targetSurf);
+            } catch (std::exception &e) {
+                m_log->warn("Exception in TrackPropagation::propagateChain: {}; skip this surface", e.what());
+            }
+            if (!result) {
+                // not reached: the next surface starts from the same state
+                continue;
+            }
+
+            current_path_length += result->second;
+            current.emplace(std::move(result->first));
+            points[isurf] = makeTrackPoint(*current, current_path_length, *targetSurf);
+        }
+
+        return points;
+    }
+
+
+
     std::unique_ptr<edm4eic::TrackPoint> TrackPropagation::propagate(const ActsExamples::Trajectories *traj,
                                                      const std::shared_ptr<const Acts::Surface> &targetSurf) {
+        const auto *tip_parameters = tipParameters(traj);
+        if (tip_parameters == nullptr) {
+            return nullptr;
+        }
+
+        m_log->trace("    TrackPropagation. Propagating to surface # {}", typeid(targetSurf->type()).name());
+
+        auto result = propagateTo(*tip_parameters, *targetSurf);
+        if (!result) {
+            return nullptr;
+        }
+        return makeTrackPoint(result->first, result->second, *targetSurf);
+    }
+
+
+
+    const Acts::BoundTrackParameters* TrackPropagation::tipParameters(const ActsExamples::Trajectories *traj) const {
         // Get the entry index for the single trajectory
         // The trajectory entry indices and the multiTrajectory
         const auto &mj = traj->multiTrajectory();
@@ -184,45 +242,45 @@ namespace eicrecon {
 
         m_log->trace("  Num measurement in trajectory: {}", m_nMeasurements);
         m_log->trace("  Num states in trajectory     : {}", m_nStates);
-
-
+        m_log->trace("  chi2                         : {:.4f}", trajState.chi2Sum);
 
         //=================================================
         //Track projection
         //Reference sPHENIX code: https://github.com/sPHENIX-Collaboration/coresoftware/blob/335e6da4ccacc8374cada993485fe81d82e74a4f/offline/packages/trackreco/PHActsTrackProjection.h
         //=================================================
-        const auto &initial_bound_parameters = traj->trackParameters(trackTip);
-
+        return &traj->trackParameters(trackTip);
+    }
 
-        m_log->trace("    TrackPropagation. Propagating to surface # {}", typeid(targetSurf->type()).name());
 
-        std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry = m_geoSvc->trackingGeometry();
-        std::shared_ptr<const Acts::MagneticFieldProvider> magneticField = m_geoSvc->getFieldProvider();
-        using Stepper = Acts::EigenStepper<>;
-        using Propagator = Acts::Propagator<Stepper>;
-        Stepper stepper(magneticField);
-        Propagator propagator(stepper);
 
-        ACTS_LOCAL_LOGGER(eicrecon::getSpdlogLogger(m_log));
+    std::optional<std::pair<Acts::BoundTrackParameters, double>> TrackPropagation::propagateTo(
+            const Acts::BoundTrackParameters &start,
+            const Acts::Surface &targetSurf) const {
 
-        Acts::PropagatorOptions<> options(m_geoContext, m_fieldContext, Acts::LoggerWrapper{logger()});
+        Acts::PropagatorOptions<> options(m_geoContext, m_fieldContext, Acts::LoggerWrapper{*m_actsLogger});
 
-        auto result = propagator.propagate(initial_bound_parameters, *targetSurf, options);
+        auto result = m_propagator->propagate(start, targetSurf, options);
 
         // check propagation result
-        if (!result.ok()) {
+        if (!result.ok() || !(*result).endParameters) {
             m_log->trace("    propagation failed (!result.ok())");
-            return nullptr;
+            return std::nullopt;
         }
         m_log->trace("    propagation result is OK");
 
+        return std::make_pair(*((*result).endParameters), static_cast<double>((*result).pathLength));
+    }
+
+
+
+    std::unique_ptr<edm4eic::TrackPoint> TrackPropagation::makeTrackPoint(const Acts::BoundTrackParameters &trackStateParams,
+                                                                         double pathLength,
+                                                                         const Acts::Surface &targetSurf) const {
         // Pulling results to convenient variables
-        auto trackStateParams = *((*result).endParameters);
         const auto &parameter = trackStateParams.parameters();
         const auto &covariance = *trackStateParams.covariance();
 
         // Path length
-        const float pathLength = (*result).pathLength;
         const float pathLengthError = 0;
         m_log->trace("    path len = {}", pathLength);
 
@@ -277,13 +335,12 @@ namespace eicrecon {
         m_log->trace("    err phi = {:.4f}", sqrt(covariance(Acts::eBoundPhi, Acts::eBoundPhi)));
         m_log->trace("    err th  = {:.4f}", sqrt(covariance(Acts::eBoundTheta, Acts::eBoundTheta)));
         m_log->trace("    err q/p = {:.4f}", sqrt(covariance(Acts::eBoundQOverP, Acts::eBoundQOverP)));
-        m_log->trace("    chi2    = {:.4f}", trajState.chi2Sum);
         m_log->trace("    loc err = {:.4f}", static_cast<float>(covariance(Acts::eBoundLoc0, Acts::eBoundLoc0)));
         m_log->trace("    loc err = {:.4f}", static_cast<float>(covariance(Acts::eBoundLoc1, Acts::eBoundLoc1)));
         m_log->trace("    loc err = {:.4f}", static_cast<float>(covariance(Acts::eBoundLoc0, Acts::eBoundLoc1)));
 
 #if EDM4EIC_VERSION_MAJOR >= 3
-        uint64_t surface = targetSurf->geometryId().value();
+        uint64_t surface = targetSurf.geometryId().value();
         uint32_t system = 0; // default value...will be set in TrackPropagation factory
 #endif
 
@@ -314,7 +371,7 @@ namespace eicrecon {
                                                theta,
                                                phi,
                                                directionError,
-                                               pathLength,
+                                               static_cast<float>(pathLength),
                                                pathLengthError
                                        });
     }
@@ -7,13 +7,18 @@
 #include <Acts/EventData/TrackParameters.hpp>
 #include <Acts/Geometry/GeometryContext.hpp>
 #include <Acts/MagneticField/MagneticFieldContext.hpp>
+#include <Acts/Propagator/EigenStepper.hpp>
+#include <Acts/Propagator/Propagator.hpp>
 #include <Acts/Surfaces/Surface.hpp>
+#include <Acts/Utilities/Logger.hpp>
 #include <Acts/Utilities/Result.hpp>
 #include <edm4eic/TrackPoint.h>
 #include <edm4eic/TrackSegmentCollection.h>
 #include <spdlog/logger.h>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "ActsExamples/EventData/Trajectories.hpp"
@@ -45,7 +50,16 @@ namespace eicrecon {
         std::vector<std::unique_ptr<edm4eic::TrackPoint>> propagateMany(std::vector<const ActsExamples::Trajectories *> trajectories,
                                                          const std::shared_ptr<const Acts::Surface> &targetSurf);
 
+        /** Propagates a single trajectory through a list of surfaces, ordered along the track.
+         * Each surface is propagated to from the last surface reached before it, or from the
+         * trajectory if there is none, so the track is only stepped once along the whole list.
+         * @return one track point per surface, null for surfaces that were not reached
+         */
+        std::vector<std::unique_ptr<edm4eic::TrackPoint>> propagateChain(const ActsExamples::Trajectories *,
+                                                                         const std::vector<std::shared_ptr<Acts::Surface>>& targetSurfaces);
+
         /** Propagates a collection of trajectories to a list of surfaces, and returns the full `TrackSegment`;
+         * the surfaces must be ordered along the track, as they are reached one after the other;
          * @param trajectories the input collection of trajectories
          * @param targetSurfaces the list of surfaces to propagate to
          * @param filterSurface if defined, do not propagate to any surfaces unless successful propagation to this filterSurface
@@ -62,6 +76,22 @@ namespace eicrecon {
             );
 
     private:
+        using Stepper = Acts::EigenStepper<>;
+        using Propagator = Acts::Propagator<Stepper>;
+
+        /** Parameters at the target surface and path length from the start, if the target is reached */
+        std::optional<std::pair<Acts::BoundTrackParameters, double>> propagateTo(const Acts::BoundTrackParameters& start,
+                                                                               const Acts::Surface& targetSurf) const;
+
+        std::unique_ptr<edm4eic::TrackPoint> makeTrackPoint(const Acts::BoundTrackParameters& params, double pathLength,
+                                                            const Acts::Surface& targetSurf) const;
+
+        /** Parameters at the tip of the first trajectory, if any */
+        const Acts::BoundTrackParameters* tipParameters(const ActsExamples::Trajectories *traj) const;
+
+        /// Built once in init(), the propagator keeps no state between calls
+        std::unique_ptr<const Propagator> m_propagator;
+        std::unique_ptr<const Acts::Logger> m_actsLogger;
 
         Acts::GeometryContext m_geoContext;
         Acts::MagneticFieldContext m_fieldContext;
@@ -4,8 +4,6 @@
 
 #include "TrackSeeding.h"
 
-#include <Acts/Utilities/KDTree.hpp> // IWYU pragma: keep FIXME KDTree missing in SeedFinderOrthogonal.hpp until Acts v23.0.0
-
 #include <Acts/Definitions/Algebra.hpp>
 #include <Acts/Definitions/Units.hpp>
 #include <Acts/Seeding/Seed.hpp>
@@ -20,9 +18,9 @@
 #include <boost/container/small_vector.hpp>
 #include <boost/container/vector.hpp>
 #include <Eigen/Core>
+#include <algorithm>
 #include <cmath>
 #include <limits>
-#include <tuple>
 #include <type_traits>
 #include <variant>
 
@@ -43,6 +41,10 @@ void eicrecon::TrackSeeding::init(std::shared_ptr<const ActsGeometryProvider> ge
     m_fieldctx = eicrecon::BField::BFieldVariant(m_BField);
 
     configure();
+
+    m_seedFinder = std::make_unique<Acts::SeedFinderOrthogonal<eicrecon::SpacePoint>>(m_seedFinderConfig);
+
+    m_perigee = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3(0,0,0));
 }
 
 void eicrecon::TrackSeeding::configure() {
@@ -127,66 +129,94 @@ std::unique_ptr<edm4eic::TrackParametersCollection> eicrecon::TrackSeeding::prod
 
   std::vector<const eicrecon::SpacePoint*> spacePoints = getSpacePoints(trk_hits);
 
-  Acts::SeedFinderOrthogonal<eicrecon::SpacePoint> finder(m_seedFinderConfig);
-  eicrecon::SeedContainer seeds = finder.createSeeds(spacePoints);
+  eicrecon::SeedContainer seeds = m_seedFinder->createSeeds(spacePoints);
 
   std::unique_ptr<edm4eic::TrackParametersCollection> trackparams = makeTrackParams(seeds);
 
-  for (auto& sp: spacePoints) {
-    delete sp;
-  }
+  // release the hits of this event, keep the capacity
+  m_spacePoints.clear();
 
   return std::move(trackparams);
 }
 
 std::vector<const eicrecon::SpacePoint*> eicrecon::TrackSeeding::getSpacePoints(const edm4eic::TrackerHitCollection& trk_hits)
 {
-  std::vector<const eicrecon::SpacePoint*> spacepoints;
-
+  // sized once, so that the pointers below stay valid
+  m_spacePoints.clear();
+  m_spacePoints.reserve(trk_hits.size());
   for(const auto hit : trk_hits)
     {
-      const eicrecon::SpacePoint* sp = new SpacePoint(hit);
-      spacepoints.push_back(sp);
+      m_spacePoints.emplace_back(hit);
+    }
+
+  std::vector<const eicrecon::SpacePoint*> spacepoints;
+  spacepoints.reserve(m_spacePoints.size());
+  for(const auto& sp : m_spacePoints)
+    {
+      spacepoints.push_back(&sp);
     }
 
   return spacepoints;
 }
 
+void eicrecon::TrackSeeding::fillBatch(const SeedContainer& seeds)
+{
+  auto& b = m_batch;
+  b.resize(seeds.size());
+
+  for (std::size_t i = 0; i < b.size; ++i) {
+    const auto& sps = seeds[i].sp();
+    double variance = 0;
+    for (std::size_t k = 0; k < SeedBatch::kHits; ++k) {
+      const auto* sp = sps[k];
+      b.x[k][i] = sp->x();
+      b.y[k][i] = sp->y();
+      b.r[k][i] = sp->r();
+      b.z[k][i] = sp->z();
+      // the hit errors are in local sensor coordinates, take the larger one in all directions
+      variance += std::max(sp->getPositionError().xx, sp->getPositionError().yy);
+    }
+    b.hitVariance[i] = variance / SeedBatch::kHits;
+  }
+}
+
 std::unique_ptr<edm4eic::TrackParametersCollection> eicrecon::TrackSeeding::makeTrackParams(SeedContainer& seeds)
 {
   auto trackparams = std::make_unique<edm4eic::TrackParametersCollection>();
 
-  for(auto& seed : seeds)
-    {
-      std::vector<std::pair<float,float>> xyHitPositions;
-      std::vector<std::pair<float,float>> rzHitPositions;
-      for(const auto& spptr : seed.sp())
-        {
-          xyHitPositions.emplace_back(spptr->x(), spptr->y());
-          rzHitPositions.emplace_back(spptr->r(), spptr->z());
-        }
+  fillBatch(seeds);
+  m_batch.fitCircles();
+  m_batch.fitLines();
 
-      auto RX0Y0 = circleFit(xyHitPositions);
-      float R = std::get<0>(RX0Y0);
-      float X0 = std::get<1>(RX0Y0);
-      float Y0 = std::get<2>(RX0Y0);
+  const auto& b = m_batch;
+  for(std::size_t i = 0; i < b.size; ++i)
+    {
+      const float R = b.R[i];
+      const float X0 = b.X0[i];
+      const float Y0 = b.Y0[i];
       if (!(std::isfinite(R) &&
         std::isfinite(std::abs(X0)) &&
         std::isfinite(std::abs(Y0)))) {
         // avoid float overflow for hits on a line
         continue;
       }
-      if ( std::hypot(X0,Y0) < std::numeric_limits<decltype(std::hypot(X0,Y0))>::epsilon() ||
-        !std::isfinite(std::hypot(X0,Y0)) ) {
+      const double R0 = std::hypot(X0, Y0);
+      if ( R0 < std::numeric_limits<decltype(std::hypot(X0,Y0))>::epsilon() ||
+        !std::isfinite(R0) ) {
         //Avoid center of circle at origin, where there is no point-of-closest approach
         //Also, avoid float overfloat on circle center
         continue;
       }
 
-      auto slopeZ0 = lineFit(rzHitPositions);
+      // determine the charge by the bend angle of the first two hits
+      int charge = 1;
+      auto dphi = std::atan2(b.y[1][i], b.x[1][i]) - std::atan2(b.y[0][i], b.x[0][i]);
+      if(dphi > M_PI) dphi = 2.*M_PI - dphi;
+      if(dphi < -M_PI) dphi = 2*M_PI + dphi;
+      if(dphi < 0) charge = -1;
 
-      int charge = determineCharge(xyHitPositions);
-      float theta = atan(1./std::get<0>(slopeZ0));
+      const double slope = b.slope[i];
+      float theta = atan(1./slope);
       // normalize to 0<theta<pi
       if(theta < 0)
         { theta += M_PI; }
@@ -195,38 +225,58 @@ std::unique_ptr<edm4eic::TrackParametersCollection> eicrecon::TrackSeeding::make
       float p = pt * cosh(eta);
       float qOverP = charge / p;
 
-      const auto xypos = findPCA(RX0Y0);
+      //Calculate point on circle closest to origin
+      const double xpos = X0 * (1. - R/R0);
+      const double ypos = Y0 * (1. - R/R0);
 
       //Calculate phi at xypos
-      auto xpos = xypos.first;
-      auto ypos = xypos.second;
-
       auto vxpos = -1.*charge*(ypos-Y0);
       auto vypos = charge*(xpos-X0);
 
       auto phi = atan2(vypos,vxpos);
 
-      const float z0 = seed.z();
-      auto perigee = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3(0,0,0));
-      Acts::Vector3 global(xypos.first, xypos.second, z0);
+      // z at the point of closest approach, from the r-z line fit
+      const double r_pca = std::hypot(xpos, ypos);
+      const float z0 = b.intercept[i] + slope * r_pca;
+      Acts::Vector3 global(xpos, ypos, z0);
 
-      auto local = perigee->globalToLocal(m_geoSvc->getActsGeometryContext(),
+      auto local = m_perigee->globalToLocal(m_geoSvc->getActsGeometryContext(),
                                           global, Acts::Vector3(1,1,1));
 
-      Acts::Vector2 localpos(sqrt(square(xypos.first) + square(xypos.second)), z0);
+      Acts::Vector2 localpos(sqrt(square(xpos) + square(ypos)), z0);
       if(local.ok())
         {
           localpos = local.value();
         }
 
+      // Covariance from the resolution of the three hits. The circle through three hits has
+      // no degree of freedom left, so the transverse errors follow from the sagitta: with a
+      // chord L between the outer hits, var(1/R) = 96 var(hit) / L^4. Multiple scattering
+      // at the middle hit, by the angle theta0 of the seed finder's highland estimate, adds
+      // 4 theta0^2 / L^2. The errors are then extrapolated over the distance d from the first
+      // hit to the point of closest approach.
+      const double var_hit = b.hitVariance[i];
+      const double theta0 = m_seedFinderConfig.highland / p;
+      const double var_ms = square(theta0);
+      const double chord2 = square(b.x[2][i] - b.x[0][i]) + square(b.y[2][i] - b.y[0][i]);
+      const double d2 = square(b.x[0][i] - xpos) + square(b.y[0][i] - ypos);
+      const double var_curvature = 96. * var_hit / square(chord2) + 4. * var_ms / chord2;
+      const double var_phi = 2. * var_hit / chord2 + var_ms + d2 * var_curvature;
+      const double var_loc0 = var_hit + d2 * var_phi + square(d2 / 2.) * var_curvature;
+      const double var_loc1 = b.varIntercept[i] + square(r_pca) * b.varSlope[i] + 2. * r_pca * b.covSlopeIntercept[i]
+                            + d2 * var_ms;
+      const double var_theta = b.varSlope[i] / square(1. + square(slope)) + var_ms;
+      const double var_qOverP = square(std::sin(theta) / m_cfg.m_bFieldInZ) * var_curvature
+                              + square(qOverP / std::tan(theta)) * var_theta;
+
       auto trackparam = trackparams->create();
       trackparam.setType(-1); // type --> seed(-1)
       trackparam.setLoc({(float)localpos(0), (float)localpos(1)}); // 2d location on surface
-      trackparam.setLocError({0.1,0.1}); //covariance of location
+      trackparam.setLocError({(float)std::sqrt(var_loc0), (float)std::sqrt(var_loc1)}); // sqrt(variance) of location
       trackparam.setTheta(theta); //theta [rad]
       trackparam.setPhi((float)phi); // phi [rad]
       trackparam.setQOverP(qOverP); // Q/p [e/GeV]
-      trackparam.setMomentumError({0.05,0.05,0.05}); // covariance on theta/phi/q/p
+      trackparam.setMomentumError({(float)std::sqrt(var_theta), (float)std::sqrt(var_phi), (float)std::sqrt(var_qOverP)}); // sqrt(variance) on theta/phi/q/p
       trackparam.setTime(10); // time in ns
       trackparam.setTimeError(0.1); // error on time
       trackparam.setCharge((float)charge); // charge
@@ -234,157 +284,3 @@ std::unique_ptr<edm4eic::TrackParametersCollection> eicrecon::TrackSeeding::make
 
   return std::move(trackparams);
 }
-std::pair<float, float> eicrecon::TrackSeeding::findPCA(std::tuple<float,float,float>& circleParams) const
-{
-  const float R = std::get<0>(circleParams);
-  const float X0 = std::get<1>(circleParams);
-  const float Y0 = std::get<2>(circleParams);
-
-  const double R0 = std::hypot(X0, Y0);
-
-  //Calculate point on circle closest to origin
-  const double xmin = X0 * (1. - R/R0);
-  const double ymin = Y0 * (1. - R/R0);
-
-  return std::make_pair(xmin,ymin);
-}
-
-int eicrecon::TrackSeeding::determineCharge(std::vector<std::pair<float,float>>& positions) const
-{
-  // determine the charge by the bend angle of the first two hits
-  int charge = 1;
-  const auto& firstpos = positions.at(0);
-  const auto& secondpos = positions.at(1);
-
-  const auto firstphi = atan2(firstpos.second, firstpos.first);
-  const auto secondphi = atan2(secondpos.second, secondpos.first);
-  auto dphi = secondphi - firstphi;
-  if(dphi > M_PI) dphi = 2.*M_PI - dphi;
-  if(dphi < -M_PI) dphi = 2*M_PI + dphi;
-  if(dphi < 0) charge = -1;
-
-  return charge;
-}
-
- /**
-   * Circle fit to a given set of data points (in 2D)
-   * This is an algebraic fit, due to Taubin, based on the journal article
-   * G. Taubin, "Estimation Of Planar Curves, Surfaces And Nonplanar
-   * Space Curves Defined By Implicit Equations, With
-   * Applications To Edge And Range Image Segmentation",
-   * IEEE Trans. PAMI, Vol. 13, pages 1115-1138, (1991)
-   * It works well whether data points are sampled along an entire circle or along a small arc.
-   * It still has a small bias and its statistical accuracy is slightly lower than that of the geometric fit (minimizing geometric distances),
-   * It provides a very good initial guess for a subsequent geometric fit.
-   * Nikolai Chernov  (September 2012)
-   */
-std::tuple<float,float,float> eicrecon::TrackSeeding::circleFit(std::vector<std::pair<float,float>>& positions) const
-{
-  // Compute x- and y- sample means
-  double meanX = 0;
-  double meanY = 0;
-  double weight = 0;
-
-  for( const auto& [x,y] : positions)
-  {
-    meanX += x;
-    meanY += y;
-    ++weight;
-  }
-  meanX /= weight;
-  meanY /= weight;
-
-  //     computing moments
-
-  double Mxx = 0;
-  double Myy = 0;
-  double Mxy = 0;
-  double Mxz = 0;
-  double Myz = 0;
-  double Mzz = 0;
-
-  for (auto& [x,y] : positions)
-  {
-    double Xi = x - meanX;   //  centered x-coordinates
-    double Yi = y - meanY;   //  centered y-coordinates
-double Zi = std::pow(Xi,2) + std::pow(Yi,2);
-
-    Mxy += Xi*Yi;
-    Mxx += Xi*Xi;
-    Myy += Yi*Yi;
-    Mxz += Xi*Zi;
-    Myz += Yi*Zi;
-    Mzz += Zi*Zi;
-  }
-  Mxx /= weight;
-  Myy /= weight;
-  Mxy /= weight;
-  Mxz /= weight;
-  Myz /= weight;
-  Mzz /= weight;
-
-  //  computing coefficients of the characteristic polynomial
-
-  const double Mz = Mxx + Myy;
-  const double Cov_xy = Mxx*Myy - Mxy*Mxy;
-  const double Var_z = Mzz - Mz*Mz;
-  const double A3 = 4*Mz;
-  const double A2 = -3*Mz*Mz - Mzz;
-  const double A1 = Var_z*Mz + 4*Cov_xy*Mz - Mxz*Mxz - Myz*Myz;
-  const double A0 = Mxz*(Mxz*Myy - Myz*Mxy) + Myz*(Myz*Mxx - Mxz*Mxy) - Var_z*Cov_xy;
-  const double A22 = A2 + A2;
-  const double A33 = A3 + A3 + A3;
-
-  //    finding the root of the characteristic polynomial
-  //    using Newton's method starting at x=0
-  //    (it is guaranteed to converge to the right root)
-  static constexpr int iter_max = 99;
-  double x = 0;
-  double y = A0;
-
-  // usually, 4-6 iterations are enough
-  for( int iter=0; iter<iter_max; ++iter)
-  {
-    const double Dy = A1 + x*(A22 + A33*x);
-    const double xnew = x - y/Dy;
-    if ((xnew == x)||(!std::isfinite(xnew))) break;
-
-    const double ynew = A0 + xnew*(A1 + xnew*(A2 + xnew*A3));
-    if (std::abs(ynew)>=std::abs(y))  break;
-
-    x = xnew;  y = ynew;
-
-  }
-
-  //  computing parameters of the fitting circle
-  const double DET = std::pow(x,2) - x*Mz + Cov_xy;
-  const double Xcenter = (Mxz*(Myy - x) - Myz*Mxy)/DET/2;
-  const double Ycenter = (Myz*(Mxx - x) - Mxz*Mxy)/DET/2;
-
-  //  assembling the output
-  float X0 = Xcenter + meanX;
-  float Y0 = Ycenter + meanY;
-  float R = std::sqrt( std::pow(Xcenter,2) + std::pow(Ycenter,2) + Mz);
-  return std::make_tuple( R, X0, Y0 );
-}
-
-std::tuple<float,float> eicrecon::TrackSeeding::lineFit(std::vector<std::pair<float,float>>& positions) const
-{
-  double xsum=0;
-  double x2sum=0;
-  double ysum=0;
-  double xysum=0;
-  for( const auto& [r,z]:positions )
-  {
-    xsum=xsum+r;                        //calculate sigma(xi)
-    ysum=ysum+z;                        //calculate sigma(yi)
-    x2sum=x2sum+std::pow(r,2);              //calculate sigma(x^2i)
-    xysum=xysum+r*z;                    //calculate sigma(xi*yi)
-  }
-
-  const auto npts = positions.size();
-  const double denominator = (x2sum*npts-std::pow(xsum,2));
-  const float a= (xysum*npts-xsum*ysum)/denominator;            //calculate slope
-  const float b= (x2sum*ysum-xsum*xysum)/denominator;           //calculate intercept
-  return std::make_tuple( a, b );
-}
@@ -6,20 +6,23 @@
 
 #include <cstddef> // IWYU pragma: keep FIXME size_t missing in SeedConfirmationRangeConfig.hpp until Acts 27.2.0 (maybe even later)
 
+#include <Acts/Utilities/KDTree.hpp> // IWYU pragma: keep FIXME KDTree missing in SeedFinderOrthogonal.hpp until Acts v23.0.0
+
 #include <Acts/MagneticField/MagneticFieldContext.hpp>
 #include <Acts/Seeding/SeedFilterConfig.hpp>
+#include <Acts/Seeding/SeedFinderOrthogonal.hpp>
 #include <Acts/Seeding/SeedFinderOrthogonalConfig.hpp>
+#include <Acts/Surfaces/PerigeeSurface.hpp>
 #include <edm4eic/TrackParametersCollection.h>
 #include <edm4eic/TrackerHitCollection.h>
 #include <spdlog/logger.h>
 #include <memory>
-#include <tuple>
-#include <utility>
 #include <vector>
 
 #include "ActsGeometryProvider.h"
 #include "DD4hepBField.h"
 #include "OrthogonalTrackSeedingConfig.h"
+#include "SeedBatch.h"
 #include "SpacePoint.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
@@ -43,12 +46,19 @@ namespace eicrecon {
         Acts::SeedFilterConfig m_seedFilterConfig;
         Acts::SeedFinderOrthogonalConfig<SpacePoint> m_seedFinderConfig;
 
-        int determineCharge(std::vector<std::pair<float,float>>& positions) const;
-        std::pair<float,float> findPCA(std::tuple<float,float,float>& circleParams) const;
+        /// Built once in init(), the finder keeps no state between calls
+        std::unique_ptr<Acts::SeedFinderOrthogonal<SpacePoint>> m_seedFinder;
+
+        /// Space points of the current event, storage is reused between events
+        std::vector<SpacePoint> m_spacePoints;
+
+        /// Hits and fit results of all seeds of an event, storage is reused between events
+        SeedBatch m_batch;
+
+        std::shared_ptr<const Acts::PerigeeSurface> m_perigee;
+
+        void fillBatch(const SeedContainer& seeds);
         std::vector<const eicrecon::SpacePoint*> getSpacePoints(const edm4eic::TrackerHitCollection& trk_hits);
         std::unique_ptr<edm4eic::TrackParametersCollection> makeTrackParams(SeedContainer& seeds);
-
-        std::tuple<float,float,float> circleFit(std::vector<std::pair<float,float>>& positions) const;
-        std::tuple<float,float> lineFit(std::vector<std::pair<float,float>>& positions) const;
     };
 }
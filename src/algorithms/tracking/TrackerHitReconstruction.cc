@@ -28,11 +28,11 @@ namespace {
     }
 } // namespace
 
-void TrackerHitReconstruction::init(const dd4hep::rec::CellIDPositionConverter* converter, std::shared_ptr<spdlog::logger>& logger) {
+void TrackerHitReconstruction::init(CellIDGeometryCache* cache, std::shared_ptr<spdlog::logger>& logger) {
 
     m_log = logger;
 
-    m_converter = converter;
+    m_cache = cache;
 }
 
 std::unique_ptr<edm4eic::TrackerHitCollection> TrackerHitReconstruction::process(const edm4eic::RawTrackerHitCollection& raw_hits) {
@@ -44,9 +44,9 @@ std::unique_ptr<edm4eic::TrackerHitCollection> TrackerHitReconstruction::process
 
         auto id = raw_hit.getCellID();
 
-        // Get position and dimension
-        auto pos = m_converter->position(id);
-        auto dim = m_converter->cellDimensions(id);
+        // Get position and dimension; pixel cellIDs rarely repeat, so their positions are not cached
+        auto pos = m_cache->converter()->position(id);
+        auto dim = m_cache->cellDimensions(id);
 
         // >oO trace
         if(m_log->level() == spdlog::level::trace) {
@@ -70,7 +70,7 @@ std::unique_ptr<edm4eic::TrackerHitCollection> TrackerHitReconstruction::process
             raw_hit.getCellID(), // Raw DD4hep cell ID
             edm4hep::Vector3f{static_cast<float>(pos.x() / mm), static_cast<float>(pos.y() / mm), static_cast<float>(pos.z() / mm)}, // mm
             edm4eic::CovDiag3f{get_variance(dim[0] / mm), get_variance(dim[1] / mm), // variance (see note above)
-            std::size(dim) > 2 ? get_variance(dim[2] / mm) : 0.},
+            get_variance(dim[2] / mm)},
                 static_cast<float>((double)(raw_hit.getTimeStamp()) / 1000.0), // ns
             m_cfg.timeResolution,                            // in ns
             static_cast<float>(raw_hit.getCharge() / 1.0e6),   // Collected energy (GeV)
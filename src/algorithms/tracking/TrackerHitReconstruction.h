@@ -3,13 +3,13 @@
 
 #pragma once
 
-#include <DDRec/CellIDPositionConverter.h>
 #include <edm4eic/RawTrackerHitCollection.h>
 #include <edm4eic/TrackerHitCollection.h>
 #include <spdlog/logger.h>
 #include <memory>
 
 #include "TrackerHitReconstructionConfig.h"
+#include "algorithms/interfaces/CellIDGeometryCache.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -21,7 +21,7 @@ namespace eicrecon {
 
     public:
         /// Once in a lifetime initialization
-        void init(const dd4hep::rec::CellIDPositionConverter* converter, std::shared_ptr<spdlog::logger>& logger);
+        void init(CellIDGeometryCache* cache, std::shared_ptr<spdlog::logger>& logger);
 
         /// Processes RawTrackerHit and produces a TrackerHit
         std::unique_ptr<edm4eic::TrackerHitCollection> process(const edm4eic::RawTrackerHitCollection& raw_hits);
@@ -33,7 +33,7 @@ namespace eicrecon {
         /** algorithm logger */
         std::shared_ptr<spdlog::logger> m_log;
 
-        /// Cell ID position converter
-        const dd4hep::rec::CellIDPositionConverter* m_converter;
+        /// Cached cell dimensions; positions go straight to its converter
+        CellIDGeometryCache* m_cache;
     };
 }
@@ -24,6 +24,9 @@
 #include <fmt/core.h>
 #include <spdlog/common.h>
 #include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <exception>
 #include <unordered_map>
 #include <utility>
@@ -33,29 +36,34 @@ namespace eicrecon {
 
 
     void TrackerMeasurementFromHits::init(const dd4hep::Detector* detector,
-                                         const dd4hep::rec::CellIDPositionConverter* converter,
+                                         CellIDGeometryCache* cell_geometry,
                                          std::shared_ptr<const ActsGeometryProvider> acts_context,
                                          std::shared_ptr<spdlog::logger> logger) {
         m_dd4hepGeo = detector;
-        m_converter = converter;
+        m_cellGeometry = cell_geometry;
         m_log = std::move(logger);
         m_acts_context = std::move(acts_context);
         m_detid_b0tracker = m_dd4hepGeo->constant<int>("B0Tracker_Station_1_ID");
+        m_clustering.applyConfig(m_cfg);
 }
 
 
-    std::unique_ptr<edm4eic::Measurement2DCollection> TrackerMeasurementFromHits::produce(std::vector<const edm4eic::TrackerHit*> trk_hits) {
+    std::unique_ptr<edm4eic::Measurement2DCollection> TrackerMeasurementFromHits::produce(std::vector<const edm4eic::TrackerHit*> trk_hits,
+                                                                                           const std::vector<std::uint32_t>& clustering_collection_ids) {
         constexpr double mm_acts = Acts::UnitConstants::mm;
         constexpr double mm_conv = mm_acts / dd4hep::mm; // = 1/0.1
 
-        // input collection
-        auto hits = trk_hits;
-
         // output collections
         auto meas2Ds = std::make_unique<edm4eic::Measurement2DCollection>();
 
-        // To do: add clustering to allow forming one measurement from several hits.
-        // For now, one hit = one measurement.
+        // the map is only read here, it is never copied
+        const auto& surfaceMap = m_acts_context->surfaceMap();
+        m_log->trace("   surfaceMap size: {}", surfaceMap.size());
+
+        // local positions of all hits on their surfaces
+        m_hits.clear();
+        m_surfaces.clear();
+        m_pixelHits.clear();
         for (const auto *hit: trk_hits) {
 
             Acts::SymMatrix2 cov = Acts::SymMatrix2::Zero();
@@ -64,19 +72,16 @@ namespace eicrecon {
             cov(0, 1) = 0.0;
 
 
-            const auto* vol_ctx = m_converter->findContext(hit->getCellID());
-            auto vol_id = vol_ctx->identifier;
-
-            auto surfaceMap = m_acts_context->surfaceMap();
+            // the sensor volume, from the cellID bits once its system is known
+            auto vol_id = m_cellGeometry->volumeID(hit->getCellID());
 
             // m_log->trace("Hit preparation information: {}", hit_index);
             m_log->trace("   System id: {}, Cell id: {}", hit->getCellID() &0xFF, hit->getCellID());
             m_log->trace("   cov matrix:      {:>12.2e} {:>12.2e}", cov(0,0), cov(0,1));
             m_log->trace("                    {:>12.2e} {:>12.2e}", cov(1,0), cov(1,1));
-            m_log->trace("   surfaceMap size: {}", surfaceMap.size());
 
             const auto is = surfaceMap.find(vol_id);
-            if (is == m_acts_context->surfaceMap().end()) {
+            if (is == surfaceMap.end()) {
                 m_log->warn(" WARNING: vol_id ({})  not found in m_surfaces.", vol_id );
                 continue;
             }
@@ -124,19 +129,29 @@ namespace eicrecon {
                 m_log->trace("   acts loc pos     : {:>10.2f} {:>10.2f}", loc[Acts::eBoundLoc0], loc[Acts::eBoundLoc1]);
             }
 
+            m_hits.push_back(hit);
+            m_surfaces.push_back(surface);
+            const bool clustering = m_cfg.m_clusteringCollections.empty()
+                || std::find(clustering_collection_ids.begin(), clustering_collection_ids.end(), hit->getObjectID().collectionID) != clustering_collection_ids.end();
+            m_pixelHits.push_back({vol_id, loc, cov, hit->getEdep(), hit->getTime(), hit->getTimeError(), clustering});
+        }
 
+        m_clustering.cluster(m_pixelHits, m_clusters);
+        for (const auto& cluster : m_clusters) {
             auto meas2D = meas2Ds->create();
-            meas2D.setSurface(surface->geometryId().value());   // Surface for bound coordinates (geometryID)
-            meas2D.setLoc({static_cast<float>(pos[0]),static_cast<float>(pos[1])});                     // 2D location on surface
-            meas2D.setTime(hit->getTime());                     // Measurement time
-            // fixme: no off-diagonal terms. cov(0,1) = cov(1,0)??
-            meas2D.setCovariance({cov(0,0),cov(1,1),hit->getTimeError(),cov(0,1)}); // Covariance on location and time
-            meas2D.addToWeights(1.0);                             // Weight for each of the hits, mirrors hits array
-            meas2D.addToHits(*hit);
+            meas2D.setSurface(m_surfaces[cluster.hits.front()]->geometryId().value());   // Surface for bound coordinates (geometryID)
+            meas2D.setLoc({static_cast<float>(cluster.loc[0]),static_cast<float>(cluster.loc[1])});                     // 2D location on surface
+            meas2D.setTime(static_cast<float>(cluster.time));                     // Measurement time
+            meas2D.setCovariance({static_cast<float>(cluster.cov(0,0)),static_cast<float>(cluster.cov(1,1)),static_cast<float>(cluster.time_error),static_cast<float>(cluster.cov(0,1))}); // Covariance on location and time
+            for (std::size_t i = 0; i < cluster.hits.size(); ++i) {
+                meas2D.addToWeights(cluster.weights[i]);                      // Weight for each of the hits, mirrors hits array
+                meas2D.addToHits(*m_hits[cluster.hits[i]]);
+            }
         }
 
         m_log->debug("All hits processed. Hits size: {}  measurements->size: {}", trk_hits.size(), meas2Ds->size());
 
         return std::move(meas2Ds);
     }
+
 } // namespace eicrecon
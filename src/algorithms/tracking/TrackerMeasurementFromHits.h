@@ -7,38 +7,60 @@
 
 #pragma once
 
+#include <Acts/Surfaces/Surface.hpp>
 #include <DD4hep/Detector.h>
 #include <DDRec/CellIDPositionConverter.h>
 #include <edm4eic/Measurement2DCollection.h>
 #include <edm4eic/TrackerHitCollection.h>
 #include <spdlog/logger.h>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 #include "ActsGeometryProvider.h"
+#include "PixelClustering.h"
+#include "TrackerMeasurementFromHitsConfig.h"
+#include "algorithms/interfaces/CellIDGeometryCache.h"
+#include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
 
-    class TrackerMeasurementFromHits {
+    /** Builds 2D measurements on the ACTS surfaces from tracker hits.
+     *
+     * With clustering enabled, hits in adjacent pixels of the same sensor form one
+     * measurement, see PixelClustering. Only hits of the collections listed in the
+     * configuration are clustered, the IDs of these collections in the event are
+     * passed to produce().
+     */
+    class TrackerMeasurementFromHits : public WithPodConfig<TrackerMeasurementFromHitsConfig> {
     public:
         void init(const dd4hep::Detector* detector,
-                  const dd4hep::rec::CellIDPositionConverter* converter,
+                  CellIDGeometryCache* cell_geometry,
                   std::shared_ptr<const ActsGeometryProvider> acts_context,
                   std::shared_ptr<spdlog::logger> logger);
 
-        std::unique_ptr<edm4eic::Measurement2DCollection> produce(std::vector<const edm4eic::TrackerHit*> trk_hits);
+        std::unique_ptr<edm4eic::Measurement2DCollection> produce(std::vector<const edm4eic::TrackerHit*> trk_hits,
+                                                                  const std::vector<std::uint32_t>& clustering_collection_ids = {});
 
     private:
         std::shared_ptr<spdlog::logger> m_log;
 
-        /// Geometry and Cell ID position converter
+        /// Geometry and cached sensor volume IDs
         const dd4hep::Detector* m_dd4hepGeo;
-        const dd4hep::rec::CellIDPositionConverter* m_converter;
+        CellIDGeometryCache* m_cellGeometry;
 
         std::shared_ptr<const ActsGeometryProvider> m_acts_context;
 
         /// Detector-specific information
         int m_detid_b0tracker;
+
+        PixelClustering m_clustering;
+
+        // scratch space reused between events, the hits and their surfaces mirror m_pixelHits
+        std::vector<const edm4eic::TrackerHit*> m_hits;
+        std::vector<const Acts::Surface*> m_surfaces;
+        std::vector<PixelHit> m_pixelHits;
+        std::vector<PixelCluster> m_clusters;
     };
 
 }
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Shujie Li
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace eicrecon {
+
+    struct TrackerMeasurementFromHitsConfig {
+        /// Merge hits in adjacent pixels of the same sensor into one measurement
+        bool m_clustering = false;
+
+        /// Hit collections whose hits are clustered, all of them if empty;
+        /// hits of other collections each become a measurement
+        std::vector<std::string> m_clusteringCollections = {};
+
+        /// Clusters with fewer hits are dropped
+        std::size_t m_minClusterSize = 1;
+
+        /// Clusters with more hits are not merged, each of their hits becomes a measurement
+        std::size_t m_maxClusterSize = 16;
+    };
+
+} // eicrecon
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2022 Whitney Armstrong, Wouter Deconinck, Dmitry Romanov, Shujie Li
+
+#include "TrackerSourceLinker.h"
+
+#include <Acts/Definitions/Algebra.hpp>
+#include <Acts/Definitions/TrackParametrization.hpp>
+#include <Acts/EventData/Measurement.hpp>
+#include <edm4eic/Cov2f.h>
+#include <edm4hep/Vector2f.h>
+#include <cstddef>
+#include <utility>
+
+namespace eicrecon {
+
+    void TrackerSourceLinker::init(std::shared_ptr<spdlog::logger> log) {
+        m_log = log;
+    }
+
+    void TrackerSourceLinker::produce(const edm4eic::Measurement2DCollection& meas2Ds, TrackerSourceLinkerResult& result) {
+
+        // cleared, keeping the capacity of the previous events
+        result.sourceLinkStorage.clear();
+        result.sourceLinks.clear();
+        result.measurements.clear();
+
+        // reserved up front: source links are referenced by address from here on
+        result.sourceLinkStorage.reserve(meas2Ds.size());
+        result.sourceLinks.reserve(meas2Ds.size());
+        result.measurements.reserve(meas2Ds.size());
+
+        std::size_t hit_index = 0;
+        for (const auto& meas2D : meas2Ds) {
+
+            // --follow example from ACTS to create source links
+            const ActsExamples::IndexSourceLink& sourceLink =
+                result.sourceLinkStorage.emplace_back(meas2D.getSurface(), hit_index);
+            // Add to output containers:
+            // index map and source link container are geometry-ordered.
+            // since the input is also geometry-ordered, new items can
+            // be added at the end.
+            result.sourceLinks.insert(result.sourceLinks.end(), sourceLink);
+            // ---
+            // Create ACTS measurements
+            Acts::Vector2 loc = Acts::Vector2::Zero();
+            loc[Acts::eBoundLoc0] = meas2D.getLoc().a;
+            loc[Acts::eBoundLoc1] = meas2D.getLoc().b;
+
+            Acts::SymMatrix2 cov = Acts::SymMatrix2::Zero();
+            cov(0, 0) = meas2D.getCovariance().xx;
+            cov(1, 1) = meas2D.getCovariance().yy;
+            cov(0, 1) = meas2D.getCovariance().xy;
+
+            auto measurement = Acts::makeMeasurement(sourceLink, loc, cov, Acts::eBoundLoc0, Acts::eBoundLoc1);
+            result.measurements.emplace_back(std::move(measurement));
+
+            hit_index++;
+        }
+
+        m_log->debug("Created {} source links and measurements", result.measurements.size());
+    }
+
+} // namespace eicrecon
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <edm4eic/Measurement2DCollection.h>
+#include <spdlog/logger.h>
+#include <memory>
+
+#include "TrackerSourceLinkerResult.h"
+
+namespace eicrecon {
+
+    /** Converts tracker measurements to ACTS source links and measurements.
+     *
+     * \ingroup tracking
+     */
+    class TrackerSourceLinker {
+    public:
+        void init(std::shared_ptr<spdlog::logger> log);
+
+        /// Fills `result`, which is cleared first; its storage is meant to be reused between events
+        void produce(const edm4eic::Measurement2DCollection& meas2Ds, TrackerSourceLinkerResult& result);
+
+    private:
+        std::shared_ptr<spdlog::logger> m_log;
+    };
+
+} // namespace eicrecon
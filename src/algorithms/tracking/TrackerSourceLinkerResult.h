@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <vector>
+
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+
+namespace eicrecon {
+
+    /** ACTS source links and measurements for the tracker measurements of one event.
+     *
+     * Built once per event and shared by every CKF pass. Source link i and
+     * measurement i correspond to element i of the input Measurement2D collection.
+     */
+    struct TrackerSourceLinkerResult {
+        TrackerSourceLinkerResult() = default;
+        // sourceLinks and measurements refer into sourceLinkStorage, so copies would dangle
+        TrackerSourceLinkerResult(const TrackerSourceLinkerResult&) = delete;
+        TrackerSourceLinkerResult& operator=(const TrackerSourceLinkerResult&) = delete;
+
+        /// Contiguous, and sized once, so that the references to its elements stay valid
+        std::vector<ActsExamples::IndexSourceLink> sourceLinkStorage;
+        /// Geometry-ordered view of sourceLinkStorage, for the CKF source link accessor
+        ActsExamples::IndexSourceLinkContainer sourceLinks;
+        ActsExamples::MeasurementContainer measurements;
+    };
+
+} // namespace eicrecon
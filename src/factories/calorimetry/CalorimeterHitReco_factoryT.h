@@ -4,6 +4,7 @@
 #pragma once
 
 #include <algorithms/calorimetry/CalorimeterHitReco.h>
+#include <services/geometry/dd4hep/CellIDGeometry_service.h>
 #include <services/geometry/dd4hep/DD4hep_service.h>
 #include <extensions/jana/JChainMultifactoryT.h>
 #include <extensions/spdlog/SpdlogMixin.h>
@@ -38,6 +39,7 @@ class CalorimeterHitReco_factoryT :
 
         // Use DD4hep_service to get dd4hep::Detector
         auto geoSvc = app->template GetService<DD4hep_service>();
+        auto cellSvc = app->template GetService<CellIDGeometry_service>();
 
         // SpdlogMixin logger initialization, sets m_log
         InitLogger(app, GetPrefix(), "info");
@@ -60,7 +62,7 @@ class CalorimeterHitReco_factoryT :
         app->SetDefaultParameter(param_prefix + ":localDetFields",   cfg.localDetFields);
 
         m_algo.applyConfig(cfg);
-        m_algo.init(geoSvc->detector(), geoSvc->converter(), logger());
+        m_algo.init(geoSvc->detector(), cellSvc->cache(), logger());
     }
 
     void Process(const std::shared_ptr<const JEvent> &event) override {
@@ -3,6 +3,7 @@
 //
 
 #include <DDRec/CellIDPositionConverter.h>
+#include <services/geometry/dd4hep/CellIDGeometry_service.h>
 #include <services/geometry/dd4hep/DD4hep_service.h>
 #include <algorithms/fardetectors/MatrixTransferStatic.h>
 #include <algorithms/fardetectors/MatrixTransferStaticConfig.h>
@@ -44,9 +45,10 @@ namespace eicrecon {
           auto cfg = GetDefaultConfig();
 
           m_geoSvc = app->GetService<DD4hep_service>();
+          auto cellSvc = app->GetService<CellIDGeometry_service>();
 
           m_reco_algo.applyConfig(cfg);
-          m_reco_algo.init(m_geoSvc->detector(), m_geoSvc->converter(), logger());
+          m_reco_algo.init(m_geoSvc->detector(), cellSvc->cache(), logger());
 
         }
 
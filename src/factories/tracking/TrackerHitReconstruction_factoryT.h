@@ -4,7 +4,7 @@
 #pragma once
 
 #include "algorithms/tracking/TrackerHitReconstruction.h"
-#include "services/geometry/dd4hep/DD4hep_service.h"
+#include "services/geometry/dd4hep/CellIDGeometry_service.h"
 #include "extensions/jana/JChainMultifactoryT.h"
 #include "extensions/spdlog/SpdlogMixin.h"
 
@@ -36,8 +36,8 @@ namespace eicrecon {
         std::string plugin_name  = GetPluginName();
         std::string param_prefix = plugin_name + ":" + GetTag();
 
-        // Use DD4hep_service to get dd4hep::Detector
-        auto geoSvc = app->template GetService<DD4hep_service>();
+        // Use CellIDGeometry_service for cached cell positions and dimensions
+        auto cellSvc = app->template GetService<CellIDGeometry_service>();
 
         // SpdlogMixin logger initialization, sets m_log
         InitLogger(app, GetPrefix(), "info");
@@ -48,7 +48,7 @@ namespace eicrecon {
         app->SetDefaultParameter(param_prefix + ":timeResolution", cfg.timeResolution);
 
         m_algo.applyConfig(cfg);
-        m_algo.init(geoSvc->converter(), logger());
+        m_algo.init(cellSvc->cache(), logger());
     }
 
     void Process(const std::shared_ptr<const JEvent> &event) override {
@@ -12,6 +12,8 @@
 #include <exception>
 #include <functional>
 #include <gsl/pointers>
+#include <memory>
+#include <vector>
 
 #include "datamodel_glue.h"
 // services
@@ -55,17 +57,17 @@ void eicrecon::PhotoMultiplierHitDigi_factory::Init() {
   set_param("enableNoise",     cfg.enableNoise,     "");
   set_param("noiseRate",       cfg.noiseRate,       "");
   set_param("noiseTimeWindow", cfg.noiseTimeWindow, "");
+  set_param("crosstalkProbability", cfg.crosstalkProbability, "probability that an avalanche triggers one more, correlated avalanche");
   // set_param("quantumEfficiency", cfg.quantumEfficiency, ""); // FIXME JParameterManager cannot use vector<pair>
 
   // Initialize digitization algorithm
   m_digi_algo.applyConfig(cfg);
   m_digi_algo.AlgorithmInit(geo_service->detector(), geo_service->converter(), m_log);
 
-  // Initialize richgeo ReadoutGeo and set random CellID visitor lambda (if a RICH)
+  // Initialize richgeo ReadoutGeo and set noise CellIDs and pixel gap mask (if a RICH)
   if(use_richgeo) {
-    m_readoutGeo->SetSeed(cfg.seed);
-    m_digi_algo.SetVisitRngCellIDs(
-        [readoutGeo = this->m_readoutGeo] (std::function<void(PhotoMultiplierHitDigi::CellIDType)> lambda, float p) { readoutGeo->VisitAllRngPixels(lambda, p); }
+    m_digi_algo.SetNoiseCellIDs(
+        std::shared_ptr<const std::vector<PhotoMultiplierHitDigi::CellIDType>>(m_readoutGeo, &m_readoutGeo->GetCellIDs())
         );
     m_digi_algo.SetPixelGapMask(
         [readoutGeo = this->m_readoutGeo] (PhotoMultiplierHitDigi::CellIDType cellID, dd4hep::Position pos) { return readoutGeo->PixelGapMask(cellID, pos); }
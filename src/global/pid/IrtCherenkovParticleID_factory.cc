@@ -5,13 +5,17 @@
 
 #include <JANA/JApplication.h>
 #include <JANA/JException.h>
+#include <TVector3.h>
 #include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
 #include <edm4eic/RawTrackerHitCollection.h>
 #include <edm4eic/TrackSegmentCollection.h>
 #include <fmt/core.h>
 #include <spdlog/logger.h>
+#include <stdint.h>
+#include <algorithm>
 #include <exception>
 #include <map>
+#include <vector>
 
 #include "datamodel_glue.h"
 #include "services/geometry/richgeo/IrtGeo.h"
@@ -28,7 +32,8 @@ void eicrecon::IrtCherenkovParticleID_factory::Init() {
   // services
   InitLogger(app, prefix, "info");
   m_richGeoSvc   = app->GetService<RichGeo_service>();
-  m_irt_det_coll = m_richGeoSvc->GetIrtGeo(plugin)->GetIrtDetectorCollection();
+  auto *irt_geo  = m_richGeoSvc->GetIrtGeo(plugin);
+  m_irt_det_coll = irt_geo->GetIrtDetectorCollection();
   m_log->debug("IrtCherenkovParticleID_factory: plugin='{}' prefix='{}'", plugin, prefix);
 
   // config
@@ -38,6 +43,7 @@ void eicrecon::IrtCherenkovParticleID_factory::Init() {
     app->SetDefaultParameter(name, val, description);
   };
   set_param("numRIndexBins", cfg.numRIndexBins, "");
+  set_param("numThreads",    cfg.numThreads,    "threads to process the charged particles of one event (1: serial); per JANA thread, so the total is this times the number of JANA threads");
   set_param("pdgList",       cfg.pdgList,       "");
   for(auto& [name,rad] : cfg.radiators) {
     set_param(name+":smearingMode",    rad.smearingMode,    "");
@@ -45,12 +51,42 @@ void eicrecon::IrtCherenkovParticleID_factory::Init() {
     set_param(name+":referenceRIndex", rad.referenceRIndex, "");
     set_param(name+":attenuation",     rad.attenuation,     "");
   }
+  set_param("fiducialPreselection", cfg.fiducialPreselection, "only use hits on sensors reachable by each track's Cherenkov photons");
+  set_param("fiducialMargin",       cfg.fiducialMargin,       "margin added to the max. Cherenkov angle for the fiducial preselection [radians]");
   set_param("cheatPhotonVertex",  cfg.cheatPhotonVertex,  "");
   set_param("cheatTrueRadiator",  cfg.cheatTrueRadiator,  "");
 
+  // sensor geometry, for the fiducial preselection
+  CherenkovSensorGeometry sensor_geometry;
+  for(const auto& [sensor_id, sensor] : irt_geo->GetSensorInfo()) {
+    const auto& pos = sensor.surface_centroid;
+    sensor_geometry.sensors.insert({
+        static_cast<uint64_t>(sensor_id),
+        { sensor.sector, TVector3(pos.x(), pos.y(), pos.z()), sensor.size }
+        });
+  }
+  for(const auto& [sector, center] : irt_geo->GetMirrorCenters())
+    sensor_geometry.mirror_centers.insert({ sector, TVector3(center.x(), center.y(), center.z()) });
+
+  // IRT geometry for each worker; the first one uses the service's geometry, the others need their own
+  // - smearing is serial (see IrtCherenkovParticleID), so no other geometries are built then
+  unsigned num_workers = std::max(cfg.numThreads, 1u);
+  for(const auto& [rad_name,cfg_rad] : cfg.radiators) {
+    if(num_workers > 1 && cfg_rad.smearing > 0) {
+      m_log->warn("Smearing of the {} radiator uses ROOT's gRandom, which is not thread safe; using 1 thread instead of {}", rad_name, num_workers);
+      num_workers = 1;
+    }
+  }
+  std::vector<CherenkovDetectorCollection*> irt_det_colls = { m_irt_det_coll };
+  m_worker_irt_geos.clear();
+  for(unsigned i_worker = 1; i_worker < num_workers; i_worker++) {
+    m_worker_irt_geos.push_back(m_richGeoSvc->MakeIrtGeo(plugin));
+    irt_det_colls.push_back(m_worker_irt_geos.back()->GetIrtDetectorCollection());
+  }
+
   // initialize underlying algorithm
   m_irt_algo.applyConfig(cfg);
-  m_irt_algo.AlgorithmInit(m_irt_det_coll, m_log);
+  m_irt_algo.AlgorithmInit(irt_det_colls, sensor_geometry, m_log);
 }
 
 //-----------------------------------------------------------------------------
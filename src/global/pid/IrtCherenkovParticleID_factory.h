@@ -21,6 +21,7 @@
 #include "extensions/jana/JChainMultifactoryT.h"
 #include "extensions/spdlog/SpdlogMixin.h"
 // services
+#include "services/geometry/richgeo/IrtGeo.h"
 #include "services/geometry/richgeo/RichGeo_service.h"
 
 namespace eicrecon {
@@ -54,9 +55,10 @@ namespace eicrecon {
 
     private:
 
-      eicrecon::IrtCherenkovParticleID m_irt_algo;
       std::shared_ptr<RichGeo_service> m_richGeoSvc;
       CherenkovDetectorCollection      *m_irt_det_coll;
+      std::vector<std::unique_ptr<richgeo::IrtGeo>> m_worker_irt_geos; // own IRT geometries of the additional workers
+      eicrecon::IrtCherenkovParticleID m_irt_algo;
 
   };
 }
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include <JANA/JApplication.h>
+#include <JANA/JEvent.h>
+#include <JANA/JFactoryT.h>
+#include <spdlog/logger.h>
+#include <exception>
+#include <map>
+
+#include "ActsExamples/EventData/Trajectories.hpp"
+#include "AdaptiveMultiVertexFinder.h"
+#include "AdaptiveMultiVertexFinder_factory.h"
+#include "services/geometry/acts/ACTSGeo_service.h"
+#include "services/io/podio/JFactoryPodioT.h"
+
+void eicrecon::AdaptiveMultiVertexFinder_factory::Init() {
+  auto *app = GetApplication();
+
+  // This prefix will be used for parameters
+  std::string plugin_name  = GetPluginName();
+  std::string param_prefix = plugin_name + ":" + GetTag();
+
+  // Initialize input tags
+  InitDataTags(param_prefix);
+
+  // Initialize logger
+  InitLogger(app, param_prefix, "info");
+
+  // Get ACTS context from ACTSGeo service
+  auto acts_service = app->GetService<ACTSGeo_service>();
+
+  // Algorithm configuration
+  auto cfg = GetDefaultConfig();
+
+  app->SetDefaultParameter(param_prefix + ":tracksMaxSignificance", cfg.m_tracksMaxSignificance,
+                           "Maximum significance of the track distance to a vertex for the track to be used in its fit");
+  app->SetDefaultParameter(param_prefix + ":maxVertexChi2", cfg.m_maxVertexChi2,
+                           "Maximum chi2 of the track distance to a vertex for the track to be compatible with it");
+  app->SetDefaultParameter(param_prefix + ":maxMergeVertexSignificance", cfg.m_maxMergeVertexSignificance,
+                           "Minimum significance of the distance between two vertices for both to be kept");
+  app->SetDefaultParameter(param_prefix + ":maxIterations", cfg.m_maxIterations,
+                           "Maximum number of vertex finding iterations");
+  app->SetDefaultParameter(param_prefix + ":useBeamSpotConstraint", cfg.m_useBeamSpotConstraint,
+                           "Whether or not to constrain the vertices to the beam spot");
+  app->SetDefaultParameter(param_prefix + ":minWeight", cfg.m_minWeight,
+                           "Minimum track weight for a track to be considered compatible with a vertex");
+  app->SetDefaultParameter(param_prefix + ":doSmoothing", cfg.m_doSmoothing,
+                           "Whether or not to refit the tracks with the vertex constraint");
+  app->SetDefaultParameter(param_prefix + ":annealingTemperatures", cfg.m_annealingTemperatures,
+                           "Temperatures of the deterministic annealing of the track weights");
+
+  // Initialize algorithm
+  m_vertexing_algo.applyConfig(cfg);
+  m_vertexing_algo.init(acts_service->actsGeoProvider(), m_log);
+}
+
+void eicrecon::AdaptiveMultiVertexFinder_factory::ChangeRun(
+    const std::shared_ptr<const JEvent>& event) {
+  JFactoryT::ChangeRun(event);
+}
+
+void eicrecon::AdaptiveMultiVertexFinder_factory::Process(const std::shared_ptr<const JEvent>& event) {
+
+  std::string input_tag = GetInputTags()[0];
+  auto trajectories     = event->Get<ActsExamples::Trajectories>(input_tag);
+
+  m_log->debug("Process method");
+
+  try {
+    auto vertices = m_vertexing_algo.produce(trajectories);
+    SetCollection(std::move(vertices));
+  } catch (std::exception& e) {
+    throw JException(e.what());
+  }
+}
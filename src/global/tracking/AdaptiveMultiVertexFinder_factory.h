@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <JANA/JEvent.h>
+#include <JANA/JException.h>
+#include <edm4eic/VertexCollection.h>
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#include "AdaptiveMultiVertexFinderConfig.h"
+#include "algorithms/tracking/AdaptiveMultiVertexFinder.h"
+#include "extensions/jana/JChainFactoryT.h"
+#include "extensions/spdlog/SpdlogMixin.h"
+
+namespace eicrecon {
+
+class AdaptiveMultiVertexFinder_factory
+    : public JChainFactoryT<edm4eic::Vertex, AdaptiveMultiVertexFinderConfig>,
+      public SpdlogMixin {
+
+public:
+  explicit AdaptiveMultiVertexFinder_factory(std::vector<std::string> default_input_tags,
+                                             AdaptiveMultiVertexFinderConfig cfg)
+      : JChainFactoryT<edm4eic::Vertex, AdaptiveMultiVertexFinderConfig>(std::move(default_input_tags),
+                                                                         cfg) {}
+
+  /** One time initialization **/
+  void Init() override;
+
+  /** On run change preparations **/
+  void ChangeRun(const std::shared_ptr<const JEvent>& event) override;
+
+  /** Event by event processing **/
+  void Process(const std::shared_ptr<const JEvent>& event) override;
+
+private:
+  eicrecon::AdaptiveMultiVertexFinder m_vertexing_algo; /// Proxy vertexing algorithm
+};
+
+} // namespace eicrecon
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include "AmbiguitySolver_factory.h"
+
+#include <JANA/JApplication.h>
+#include <JANA/JEvent.h>
+#include <JANA/JException.h>
+#include <spdlog/logger.h>
+#include <exception>
+
+#include "datamodel_glue.h"
+
+void eicrecon::AmbiguitySolver_factory::Init() {
+    auto *app = GetApplication();
+
+    // This prefix will be used for parameters
+    std::string plugin_name = GetPluginName();
+    std::string param_prefix = plugin_name+ ":" + GetTag();
+
+    // Initialize logger
+    InitLogger(app, param_prefix, "info");
+
+    // Algorithm configuration
+    auto cfg = GetDefaultConfig();
+    app->SetDefaultParameter(param_prefix + ":MaxSharedHits", cfg.m_maxSharedHits, "Maximum number of measurements a track may share with other tracks");
+    app->SetDefaultParameter(param_prefix + ":MaxIterations", cfg.m_maxIterations, "Maximum number of tracks removed for shared measurements");
+    app->SetDefaultParameter(param_prefix + ":MinMeasurements", cfg.m_minMeasurements, "Minimum number of measurements of a track");
+    app->SetDefaultParameter(param_prefix + ":MaxChi2Ndf", cfg.m_maxChi2Ndf, "Maximum chi2/ndf of a track");
+
+    // Initialize algorithm
+    m_ambiguity_solver.applyConfig(cfg);
+    m_ambiguity_solver.init(m_log);
+}
+
+void eicrecon::AmbiguitySolver_factory::Process(const std::shared_ptr<const JEvent> &event) {
+    // 0 and 1 as ordered in tracking.cc
+    auto trajectories = static_cast<const edm4eic::TrajectoryCollection*>(event->GetCollectionBase(GetInputTags()[0]));
+    auto acts_trajectories = event->Get<ActsExamples::Trajectories>(GetInputTags()[1]);
+
+    if(!trajectories) {
+        m_log->warn("CKF trajectories are null (haven't been produced?). Skipping ambiguity resolution for the whole event!");
+        return;
+    }
+
+    try {
+        auto [out_trajectories, out_track_parameters, out_acts_trajectories] = m_ambiguity_solver.process(
+                *trajectories,
+                acts_trajectories);
+
+        // Save the result
+        SetCollection<edm4eic::Trajectory>(GetOutputTags()[0], std::move(out_trajectories));
+        SetCollection<edm4eic::TrackParameters>(GetOutputTags()[1], std::move(out_track_parameters));
+        // JANA holds non-const pointers, the trajectories are not modified
+        std::vector<ActsExamples::Trajectories*> acts_trajectories_out;
+        acts_trajectories_out.reserve(out_acts_trajectories.size());
+        for (const auto* acts_trajectory : out_acts_trajectories) {
+            acts_trajectories_out.push_back(const_cast<ActsExamples::Trajectories*>(acts_trajectory));
+        }
+        SetData<ActsExamples::Trajectories>(GetOutputTags()[2], std::move(acts_trajectories_out));
+    }
+    catch(std::exception &e) {
+        throw JException(e.what());
+    }
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <JANA/JEvent.h>
+#include <edm4eic/TrackParametersCollection.h>
+#include <edm4eic/TrajectoryCollection.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ActsExamples/EventData/Trajectories.hpp"
+#include "algorithms/tracking/AmbiguitySolver.h"
+#include "algorithms/tracking/AmbiguitySolverConfig.h"
+#include "extensions/jana/JChainMultifactoryT.h"
+#include "extensions/spdlog/SpdlogMixin.h"
+
+namespace eicrecon {
+
+    class AmbiguitySolver_factory :
+            public JChainMultifactoryT<AmbiguitySolverConfig>,
+            public SpdlogMixin {
+
+    public:
+
+        explicit AmbiguitySolver_factory(
+            std::string tag,
+            const std::vector<std::string>& input_tags,
+            const std::vector<std::string>& output_tags,
+            AmbiguitySolverConfig cfg)
+        : JChainMultifactoryT<AmbiguitySolverConfig>(std::move(tag), input_tags, output_tags, cfg) {
+
+            DeclarePodioOutput<edm4eic::Trajectory>(GetOutputTags()[0]);
+            DeclarePodioOutput<edm4eic::TrackParameters>(GetOutputTags()[1]);
+            // the selected trajectories are those of the input, owned by its factory, so JANA does not own them
+            DeclareOutput<ActsExamples::Trajectories>(GetOutputTags()[2], false);
+
+        }
+
+        /** One time initialization **/
+        void Init() override;
+
+        /** Event by event processing **/
+        void Process(const std::shared_ptr<const JEvent> &event) override;
+
+    private:
+
+        AmbiguitySolver m_ambiguity_solver;
+
+    };
+
+} // eicrecon
@@ -14,6 +14,7 @@
 
 #include "CKFTracking.h"
 #include "CKFTrackingConfig.h"
+#include "TrackerSourceLinkerResult.h"
 #include "datamodel_glue.h"
 #include "services/geometry/acts/ACTSGeo_service.h"
 
@@ -36,6 +37,8 @@ void eicrecon::CKFTracking_factory::Init() {
     app->SetDefaultParameter(param_prefix + ":EtaBins", cfg.m_etaBins, "Eta Bins for ACTS CKF tracking reco");
     app->SetDefaultParameter(param_prefix + ":Chi2CutOff", cfg.m_chi2CutOff, "Chi2 Cut Off for ACTS CKF tracking");
     app->SetDefaultParameter(param_prefix + ":NumMeasurementsCutOff", cfg.m_numMeasurementsCutOff, "Number of measurements Cut Off for ACTS CKF tracking");
+    app->SetDefaultParameter(param_prefix + ":NumThreads", cfg.m_numThreads, "Threads for ACTS CKF tracking within one event (1: serial)");
+    app->SetDefaultParameter(param_prefix + ":SeedBatchSize", cfg.m_seedBatchSize, "Seeds per task for ACTS CKF tracking on several threads");
 
     // Initialize algorithm
     m_tracking_algo.applyConfig(cfg);
@@ -44,10 +47,11 @@ void eicrecon::CKFTracking_factory::Init() {
 
 void eicrecon::CKFTracking_factory::Process(const std::shared_ptr<const JEvent> &event) {
     // Collect all inputs
-    auto seed_track_parameters = static_cast<const edm4eic::TrackParametersCollection*>(event->GetCollectionBase(GetInputTags()[0])); // 0 and 1 as ordered in tracking.cc
+    auto seed_track_parameters = static_cast<const edm4eic::TrackParametersCollection*>(event->GetCollectionBase(GetInputTags()[0])); // 0, 1 and 2 as ordered in tracking.cc
     auto meas2Ds = static_cast<const edm4eic::Measurement2DCollection*>(event->GetCollectionBase(GetInputTags()[1]));
+    auto source_links = event->Get<TrackerSourceLinkerResult>(GetInputTags()[2]); // shared between all CKF passes
 
-    if(!meas2Ds) {
+    if(!meas2Ds || source_links.empty()) {
         m_log->warn("TrackerMeasurementFromHits is null (hasn't been produced?). Skipping tracking for the whole event!");
         return;
     }
@@ -56,6 +60,7 @@ void eicrecon::CKFTracking_factory::Process(const std::shared_ptr<const JEvent>
         // RUN TRACKING ALGORITHM
         auto [trajectories, track_parameters, acts_trajectories] = m_tracking_algo.process(
                 *meas2Ds,
+                *source_links.front(),
                 *seed_track_parameters);
 
         // Save the result
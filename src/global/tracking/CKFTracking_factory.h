@@ -38,7 +38,8 @@ namespace eicrecon {
 
             DeclarePodioOutput<edm4eic::Trajectory>(GetOutputTags()[0]);
             DeclarePodioOutput<edm4eic::TrackParameters>(GetOutputTags()[1]);
-            DeclareOutput<ActsExamples::Trajectories>(GetOutputTags()[2]);
+            // the trajectories are reused between events by m_tracking_algo, so JANA does not own them
+            DeclareOutput<ActsExamples::Trajectories>(GetOutputTags()[2], false);
 
         }
 
@@ -55,17 +55,27 @@ void eicrecon::TrackPropagation_factory::Process(const std::shared_ptr<const JEv
 
     edm4eic::TrackSegmentCollection propagated_tracks;
 
+    std::vector<std::unique_ptr<edm4eic::TrackPoint>> prop_points(m_target_surface_list.size());
+
     for(auto traj: trajectories) {
+        for(std::size_t ichain = 0; ichain < m_target_chains.size(); ichain++) {
+            auto chain_points = m_track_propagation_algo.propagateChain(traj, m_target_chain_surfaces[ichain]);
+            for(std::size_t ipoint = 0; ipoint < chain_points.size(); ipoint++) {
+                prop_points[m_target_chains[ichain][ipoint]] = std::move(chain_points[ipoint]);
+            }
+        }
+
+        // keep the order of m_target_surface_list in the output
         edm4eic::MutableTrackSegment this_propagated_track;
-        for(size_t isurf = 0; auto surf: m_target_surface_list) {
-            auto prop_point = m_track_propagation_algo.propagate(traj, surf);
+        for(std::size_t isurf = 0; isurf < prop_points.size(); isurf++) {
+            auto& prop_point = prop_points[isurf];
             if(!prop_point) continue;
 #if EDM4EIC_VERSION_MAJOR >= 3
             prop_point->surface = m_target_surface_ID[isurf];
             prop_point->system = m_target_detector_ID[isurf];
 #endif
             this_propagated_track.addToPoints(*prop_point);
-            isurf++;
+            prop_point.reset();
         }
         propagated_tracks.push_back(this_propagated_track);
     }
@@ -198,6 +208,19 @@ void eicrecon::TrackPropagation_factory::SetPropagationSurfaces() {
     m_target_detector_ID.push_back(m_geoSvc->detector()->constant<uint32_t>("HCalEndcapN_ID"));
     m_target_surface_ID.push_back(2);
 
+    // Calorimeters in the same region are crossed in order, so the HCAL surfaces are reached
+    // from the ECAL ones instead of from the last tracker state
+    m_target_chains = {
+        {0, 1, 6, 7},   // barrel: BEMC, OHCAL
+        {2, 3, 8, 9},   // forward: FEMC, LFHCAL
+        {4, 5, 10, 11}, // backward: EEMC, EHCAL
+    };
+    for(const auto& chain: m_target_chains) {
+        auto& chain_surfaces = m_target_chain_surfaces.emplace_back();
+        for(auto isurf: chain) {
+            chain_surfaces.push_back(m_target_surface_list.at(isurf));
+        }
+    }
 
     m_log->info("Setting track propagation surfaces to:");
     m_log->info("EEMC_Z    = {}", EEMC_Z);
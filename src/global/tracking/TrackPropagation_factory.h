@@ -10,6 +10,7 @@
 #include <extensions/jana/JChainMultifactoryT.h>
 #include <extensions/spdlog/SpdlogMixin.h>
 #include <services/geometry/dd4hep/DD4hep_service.h>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -49,6 +50,11 @@ namespace eicrecon {
         std::vector<uint64_t> m_target_surface_ID;
         std::vector<uint32_t> m_target_detector_ID;
 
+        // Surfaces that a track crosses one after the other, each chain is propagated in one pass.
+        // m_target_chains holds the indices into m_target_surface_list, in the order of the chain
+        std::vector<std::vector<std::size_t>> m_target_chains;
+        std::vector<std::vector<std::shared_ptr<Acts::Surface>>> m_target_chain_surfaces;
+
         void SetPropagationSurfaces();
 
 };
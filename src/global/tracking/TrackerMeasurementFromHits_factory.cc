@@ -15,6 +15,7 @@
 #include "algorithms/tracking/TrackerMeasurementFromHits.h"
 #include "extensions/spdlog/SpdlogExtensions.h"
 #include "services/geometry/acts/ACTSGeo_service.h"
+#include "services/geometry/dd4hep/CellIDGeometry_service.h"
 #include "services/geometry/dd4hep/DD4hep_service.h"
 #include "services/io/podio/JFactoryPodioT.h"
 #include "services/log/Log_service.h"
@@ -48,8 +49,17 @@ namespace eicrecon {
 
         auto dd4hep_service = GetApplication()->GetService<DD4hep_service>();
 
+        // Algorithm configuration
+        auto cfg = GetDefaultConfig();
+        pm->SetDefaultParameter(param_prefix + ":Clustering", cfg.m_clustering, "Merge hits in adjacent pixels into one measurement");
+        pm->SetDefaultParameter(param_prefix + ":ClusteringCollections", cfg.m_clusteringCollections, "Hit collections whose hits are clustered, all if empty");
+        pm->SetDefaultParameter(param_prefix + ":MinClusterSize", cfg.m_minClusterSize, "Minimum number of hits in a cluster, smaller clusters are dropped");
+        pm->SetDefaultParameter(param_prefix + ":MaxClusterSize", cfg.m_maxClusterSize, "Maximum number of hits in a cluster, hits of larger clusters are kept as separate measurements");
+
         // Initialize algorithm
-        m_measurement.init(dd4hep_service->detector(), dd4hep_service->converter(), acts_service->actsGeoProvider(), m_log);
+        m_measurement.applyConfig(cfg);
+        auto cell_geometry = GetApplication()->GetService<CellIDGeometry_service>();
+        m_measurement.init(dd4hep_service->detector(), cell_geometry->cache(), acts_service->actsGeoProvider(), m_log);
     }
 
 
@@ -71,8 +81,19 @@ namespace eicrecon {
         }
         m_log->debug("TrackerMeasurementFromHits_factory::Process");
 
+        // IDs in this event of the collections whose hits are clustered, collections which are not produced are skipped
+        m_clustering_collection_ids.clear();
+        for (const auto& name : m_measurement.getConfig().m_clusteringCollections) {
+            try {
+                m_clustering_collection_ids.push_back(event->GetCollectionBase(name)->getID());
+            }
+            catch (std::exception &e) {
+                m_log->debug("Clustering collection {} not found: {}", name, e.what());
+            }
+        }
+
         try {
-            auto result = m_measurement.produce(total_hits);
+            auto result = m_measurement.produce(total_hits, m_clustering_collection_ids);
             SetCollection(std::move(result));
         }
         catch(std::exception &e) {
@@ -11,6 +11,7 @@
 #include <spdlog/logger.h>
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -19,15 +20,16 @@
 
 #include "algorithms/interfaces/WithPodConfig.h"
 #include "algorithms/tracking/TrackerMeasurementFromHits.h"
+#include "algorithms/tracking/TrackerMeasurementFromHitsConfig.h"
 #include "extensions/jana/JChainFactoryT.h"
 
 namespace eicrecon {
 
-    class TrackerMeasurementFromHits_factory : public JChainFactoryT<edm4eic::Measurement2D, NoConfig>{
+    class TrackerMeasurementFromHits_factory : public JChainFactoryT<edm4eic::Measurement2D, TrackerMeasurementFromHitsConfig>{
 
     public:
-        TrackerMeasurementFromHits_factory( std::vector<std::string> default_input_tags):
-                JChainFactoryT<edm4eic::Measurement2D, NoConfig>(std::move(default_input_tags) ) {
+        TrackerMeasurementFromHits_factory( std::vector<std::string> default_input_tags, TrackerMeasurementFromHitsConfig cfg):
+                JChainFactoryT<edm4eic::Measurement2D, TrackerMeasurementFromHitsConfig>(std::move(default_input_tags), cfg) {
         }
 
         /** One time initialization **/
@@ -44,6 +46,7 @@ namespace eicrecon {
         std::shared_ptr<spdlog::logger> m_log;              /// Logger for this factory
         std::vector<std::string> m_input_tags;              /// Tags of factories that provide input data
         eicrecon::TrackerMeasurementFromHits m_measurement;      /// Tracker measurement algorithm
+        std::vector<std::uint32_t> m_clustering_collection_ids;  /// IDs of the collections to cluster in the current event
     };
 
 } // eicrecon
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include "TrackerSourceLinker_factory.h"
+
+#include <JANA/JApplication.h>
+#include <JANA/JEvent.h>
+#include <JANA/JException.h>
+#include <edm4eic/Measurement2DCollection.h>
+#include <spdlog/logger.h>
+#include <exception>
+
+void eicrecon::TrackerSourceLinker_factory::Init() {
+    auto *app = GetApplication();
+
+    // This prefix will be used for parameters
+    std::string plugin_name = GetPluginName();
+    std::string param_prefix = plugin_name+ ":" + GetTag();
+
+    // Initialize logger
+    InitLogger(app, param_prefix, "info");
+
+    // Initialize algorithm
+    m_source_linker.init(m_log);
+}
+
+void eicrecon::TrackerSourceLinker_factory::Process(const std::shared_ptr<const JEvent> &event) {
+    auto meas2Ds = static_cast<const edm4eic::Measurement2DCollection*>(event->GetCollectionBase(GetInputTags()[0]));
+
+    if(!meas2Ds) {
+        m_log->warn("TrackerMeasurementFromHits is null (hasn't been produced?). Skipping source links for the whole event!");
+        return;
+    }
+
+    try {
+        m_source_linker.produce(*meas2Ds, m_result);
+        SetData<TrackerSourceLinkerResult>(GetOutputTags()[0], {&m_result});
+    }
+    catch(std::exception &e) {
+        throw JException(e.what());
+    }
+}
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <JANA/JEvent.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "algorithms/interfaces/WithPodConfig.h"
+#include "algorithms/tracking/TrackerSourceLinker.h"
+#include "algorithms/tracking/TrackerSourceLinkerResult.h"
+#include "extensions/jana/JChainMultifactoryT.h"
+#include "extensions/spdlog/SpdlogMixin.h"
+
+namespace eicrecon {
+
+    class TrackerSourceLinker_factory :
+            public JChainMultifactoryT<NoConfig>,
+            public SpdlogMixin {
+
+    public:
+
+        explicit TrackerSourceLinker_factory(
+            std::string tag,
+            const std::vector<std::string>& input_tags,
+            const std::vector<std::string>& output_tags)
+        : JChainMultifactoryT<NoConfig>(std::move(tag), input_tags, output_tags) {
+
+            // m_result is reused between events, so JANA does not own it
+            DeclareOutput<TrackerSourceLinkerResult>(GetOutputTags()[0], false);
+
+        }
+
+        /** One time initialization **/
+        void Init() override;
+
+        /** Event by event processing **/
+        void Process(const std::shared_ptr<const JEvent> &event) override;
+
+    private:
+
+        TrackerSourceLinker m_source_linker;
+        TrackerSourceLinkerResult m_result;  // storage reused between events
+
+    };
+
+} // eicrecon
@@ -4,8 +4,11 @@
 //
 
 #include <JANA/JApplication.h>
+#include <JANA/JException.h>
 #include <string>
 
+#include "AdaptiveMultiVertexFinder_factory.h"
+#include "AmbiguitySolver_factory.h"
 #include "CKFTrackingConfig.h"
 #include "CKFTracking_factory.h"
 #include "IterativeVertexFinder_factory.h"
@@ -14,6 +17,7 @@
 #include "TrackPropagation_factory.h"
 #include "TrackSeeding_factory.h"
 #include "TrackerMeasurementFromHits_factory.h"
+#include "TrackerSourceLinker_factory.h"
 #include "extensions/jana/JChainFactoryGeneratorT.h"
 #include "extensions/jana/JChainMultifactoryGeneratorT.h"
 #include "factories/tracking/TrackerHitCollector_factory.h"
@@ -47,20 +51,52 @@ void InitPlugin(JApplication *app) {
         {"CentralTrackingRecHits"}, // Output collection name
         app));
 
+    // Pixel clustering only in the silicon trackers
+    TrackerMeasurementFromHitsConfig measurement_cfg;
+    measurement_cfg.m_clustering = true;
+    measurement_cfg.m_clusteringCollections = {
+        "SiBarrelTrackerRecHits",
+        "SiBarrelVertexRecHits",
+        "SiEndcapTrackerRecHits",
+    };
     app->Add(new JChainFactoryGeneratorT<TrackerMeasurementFromHits_factory>(
-            {"CentralTrackingRecHits"}, "CentralTrackerMeasurements"));
+            {"CentralTrackingRecHits"}, "CentralTrackerMeasurements", measurement_cfg));
+
+    // Source links and ACTS measurements, shared by the CKF passes below
+    app->Add(new JChainMultifactoryGeneratorT<TrackerSourceLinker_factory>(
+        "CentralTrackerSourceLinker",
+        {"CentralTrackerMeasurements"},
+        {"CentralTrackerSourceLinks"},
+        app
+    ));
 
     app->Add(new JChainMultifactoryGeneratorT<CKFTracking_factory>(
         "CentralCKFTrajectories",
         {
             "InitTrackParams",
-            "CentralTrackerMeasurements"
+            "CentralTrackerMeasurements",
+            "CentralTrackerSourceLinks"
+        },
+        {
+            "CentralCKFUnresolvedTrajectories",
+            "CentralCKFUnresolvedTrackParameters",
+            "CentralCKFUnresolvedActsTrajectories",
+        },
+        app
+    ));
+
+    app->Add(new JChainMultifactoryGeneratorT<AmbiguitySolver_factory>(
+        "CentralAmbiguitySolver",
+        {
+            "CentralCKFUnresolvedTrajectories",
+            "CentralCKFUnresolvedActsTrajectories"
         },
         {
             "CentralCKFTrajectories",
             "CentralCKFTrackParameters",
             "CentralCKFActsTrajectories",
         },
+        {},
         app
     ));
 
@@ -71,21 +107,47 @@ void InitPlugin(JApplication *app) {
         "CentralCKFSeededTrajectories",
         {
             "CentralTrackSeedingResults",
-            "CentralTrackerMeasurements"
+            "CentralTrackerMeasurements",
+            "CentralTrackerSourceLinks"
+        },
+        {
+            "CentralCKFSeededUnresolvedTrajectories",
+            "CentralCKFSeededUnresolvedTrackParameters",
+            "CentralCKFSeededUnresolvedActsTrajectories",
+        },
+        app
+    ));
+
+    app->Add(new JChainMultifactoryGeneratorT<AmbiguitySolver_factory>(
+        "CentralSeededAmbiguitySolver",
+        {
+            "CentralCKFSeededUnresolvedTrajectories",
+            "CentralCKFSeededUnresolvedActsTrajectories"
         },
         {
             "CentralCKFSeededTrajectories",
             "CentralCKFSeededTrackParameters",
             "CentralCKFSeededActsTrajectories",
         },
+        {},
         app
     ));
 
     app->Add(new JChainFactoryGeneratorT<TrackProjector_factory>(
             {"CentralCKFActsTrajectories"}, "CentralTrackSegments"));
 
-    app->Add(new JChainFactoryGeneratorT<IterativeVertexFinder_factory>(
-            {"CentralCKFActsTrajectories"}, "CentralTrackVertices"));
+    // Primary vertexing, by the iterative (IVF) or the adaptive multi-vertex finder (AMVF)
+    std::string vertex_finder = "IVF";
+    app->SetDefaultParameter("tracking:VertexFinder", vertex_finder, "Vertex finder for CentralTrackVertices: IVF (iterative) or AMVF (adaptive multi-vertex)");
+    if (vertex_finder == "IVF") {
+        app->Add(new JChainFactoryGeneratorT<IterativeVertexFinder_factory>(
+                {"CentralCKFActsTrajectories"}, "CentralTrackVertices"));
+    } else if (vertex_finder == "AMVF") {
+        app->Add(new JChainFactoryGeneratorT<AdaptiveMultiVertexFinder_factory>(
+                {"CentralCKFActsTrajectories"}, "CentralTrackVertices"));
+    } else {
+        throw JException("Unknown tracking:VertexFinder '" + vertex_finder + "', expected IVF or AMVF");
+    }
 
     app->Add(new JChainMultifactoryGeneratorT<TrackPropagation_factory>(
             "CalorimeterTrackPropagator",
@@ -8,10 +8,14 @@
 #include <JANA/JException.h>
 #include <fmt/core.h>
 #include <fmt/format.h>
+#include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <gsl/pointers>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "ActsGeometryProvider.h"
 #include "extensions/spdlog/SpdlogExtensions.h"
@@ -47,6 +51,25 @@ std::shared_ptr<const ActsGeometryProvider> ACTSGeo_service::actsGeoProvider() {
             }
             m_app->SetDefaultParameter("acts:MaterialMap", material_map_file, "JSON/CBOR material map file path");
 
+            // Optional interpolated magnetic field grid
+            bool field_grid_enabled = false;
+            eicrecon::BField::DD4hepBField::GridConfig field_grid;
+            std::vector<double> field_grid_min(field_grid.min.begin(), field_grid.min.end());
+            std::vector<double> field_grid_max(field_grid.max.begin(), field_grid.max.end());
+            std::vector<double> field_grid_step(field_grid.step.begin(), field_grid.step.end());
+            std::size_t field_grid_validation = 0;
+            m_app->SetDefaultParameter("acts:FieldGrid", field_grid_enabled, "Precompute the magnetic field on a grid and interpolate it trilinearly");
+            m_app->SetDefaultParameter("acts:FieldGridMin", field_grid_min, "Lower x,y,z corner of the magnetic field grid [mm]");
+            m_app->SetDefaultParameter("acts:FieldGridMax", field_grid_max, "Upper x,y,z corner of the magnetic field grid [mm]");
+            m_app->SetDefaultParameter("acts:FieldGridStep", field_grid_step, "x,y,z spacing of the magnetic field grid [mm]");
+            m_app->SetDefaultParameter("acts:FieldGridValidation", field_grid_validation, "Number of random points at which to report the deviation of the grid from the exact field (0 to disable)");
+            if (field_grid_min.size() != 3 || field_grid_max.size() != 3 || field_grid_step.size() != 3) {
+                throw JException("acts:FieldGridMin, acts:FieldGridMax and acts:FieldGridStep need 3 values (x,y,z)");
+            }
+            std::copy(field_grid_min.begin(), field_grid_min.end(), field_grid.min.begin());
+            std::copy(field_grid_max.begin(), field_grid_max.end(), field_grid.max.begin());
+            std::copy(field_grid_step.begin(), field_grid_step.end(), field_grid.step.begin());
+
             // Reading the geometry may take a long time and if the JANA ticker is enabled, it will keep printing
             // while no other output is coming which makes it look like something is wrong. Disable the ticker
             // while parsing and loading the geometry
@@ -55,7 +78,17 @@ std::shared_ptr<const ActsGeometryProvider> ACTSGeo_service::actsGeoProvider() {
 
             // Initialize m_acts_provider
             m_acts_provider = std::make_shared<ActsGeometryProvider>();
-            m_acts_provider->initialize(m_dd4hepGeo, material_map_file, m_log, m_init_log);
+            m_acts_provider->initialize(m_dd4hepGeo, material_map_file, m_log, m_init_log,
+                                        field_grid_enabled ? std::make_optional(field_grid) : std::nullopt,
+                                        field_grid_validation);
+
+            // Surfaces dump for debugging, only written on request since it costs startup time
+            std::string obj_file;
+            m_app->SetDefaultParameter("acts:ObjFile", obj_file, "Write the ACTS tracking surfaces to this OBJ file (e.g. tracking_geometry.obj), empty to skip");
+            if (!obj_file.empty()) {
+                m_init_log->info("Writing tracking surfaces to '{}'", obj_file);
+                draw_surfaces(m_acts_provider->trackingGeometry(), m_acts_provider->getActsGeometryContext(), obj_file);
+            }
 
             // Enable ticker back
             m_app->SetTicker(tickerEnabled);
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include "CellIDGeometry_service.h"
+
+#include "DD4hep_service.h"
+
+void CellIDGeometry_service::acquire_services(JServiceLocator *srv_locator) {
+    // geometry is only loaded when the cache is first used
+    m_dd4hep_service = srv_locator->get<DD4hep_service>();
+}
+
+//----------------------------------------------------------------
+// cache
+//
+/// Return pointer to the cellID geometry cache.
+/// Create it on the first call.
+//----------------------------------------------------------------
+gsl::not_null<eicrecon::CellIDGeometryCache*>
+CellIDGeometry_service::cache() {
+    std::call_once(init_flag, [this]() {
+        m_cache = std::make_unique<eicrecon::CellIDGeometryCache>(m_dd4hep_service->detector(), m_dd4hep_service->converter());
+    });
+    return m_cache.get();
+}
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#pragma once
+
+#include <JANA/JApplication.h>
+#include <JANA/Services/JServiceLocator.h>
+#include <gsl/pointers>
+#include <memory>
+#include <mutex>
+
+#include "algorithms/interfaces/CellIDGeometryCache.h"
+
+class DD4hep_service;
+
+/** Shared cache of per-volume and per-cell geometry lookups on the DD4hep geometry.
+ *
+ * One cache is shared by all factories and threads, so that the lookups of
+ * a cell are only done once per job. It is created on first use.
+ */
+class CellIDGeometry_service : public JService
+{
+public:
+    CellIDGeometry_service( JApplication *app ) : app(app) {}
+    virtual ~CellIDGeometry_service() = default;
+
+    virtual gsl::not_null<eicrecon::CellIDGeometryCache*> cache();
+
+private:
+    CellIDGeometry_service()=default;
+    void acquire_services(JServiceLocator *) override;
+
+    std::once_flag init_flag;
+    JApplication *app = nullptr;
+    std::shared_ptr<DD4hep_service> m_dd4hep_service;
+    std::unique_ptr<eicrecon::CellIDGeometryCache> m_cache;
+};
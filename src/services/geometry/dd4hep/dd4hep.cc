@@ -6,11 +6,13 @@
 #include <JANA/JApplication.h>
 #include <memory>
 
+#include "CellIDGeometry_service.h"
 #include "DD4hep_service.h"
 
 extern "C" {
 void InitPlugin(JApplication *app) {
     InitJANAPlugin(app);
     app->ProvideService(std::make_shared<DD4hep_service>(app) );
+    app->ProvideService(std::make_shared<CellIDGeometry_service>(app) );
 }
 }
@@ -13,6 +13,7 @@
 #include <IRT/CherenkovDetectorCollection.h>
 #include <spdlog/logger.h>
 #include <gsl/pointers>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -31,6 +32,10 @@ namespace richgeo {
       // access the full IRT geometry
       CherenkovDetectorCollection *GetIrtDetectorCollection() { return m_irtDetectorCollection; }
 
+      // access sensor info and focusing mirrors, e.g., to decide which sensors a track can reach
+      const std::unordered_map<int,richgeo::Sensor>& GetSensorInfo() const { return m_sensor_info; }
+      const std::map<int,dd4hep::Position>& GetMirrorCenters() const { return m_mirror_centers; }
+
     protected:
 
       // protected methods
@@ -54,6 +59,7 @@ namespace richgeo {
       // cell ID conversion
       gsl::not_null<const dd4hep::rec::CellIDPositionConverter*> m_converter;
       std::unordered_map<int,richgeo::Sensor> m_sensor_info; // sensor ID -> sensor info
+      std::map<int,dd4hep::Position> m_mirror_centers;      // sector -> center of curvature of its focusing mirror [mm]; empty for proximity focusing
 
       // IRT geometry handles
       CherenkovDetectorCollection *m_irtDetectorCollection;
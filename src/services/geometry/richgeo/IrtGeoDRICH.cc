@@ -120,6 +120,7 @@ void richgeo::IrtGeoDRICH::DD4hep_to_IRT() {
         false                                // bool refractive
         );
     m_irtDetector->AddOpticalBoundary(isec, m_mirrorOpticalBoundary);
+    m_mirror_centers.insert({ isec, mirrorCenter });
     m_log->debug("");
     m_log->debug("  SECTOR {:d} MIRROR:", isec);
     m_log->debug("    mirror x = {:f} mm", mirrorCenter.x());
@@ -159,6 +160,7 @@ void richgeo::IrtGeoDRICH::DD4hep_to_IRT() {
         // add sensor info to `m_sensor_info` map
         richgeo::Sensor sensor_info;
         sensor_info.size             = sensorSize;
+        sensor_info.sector           = isec;
         sensor_info.surface_centroid = posSensor;
         sensor_info.surface_offset   = surfaceOffset;
         m_sensor_info.insert({ sensorID, sensor_info });
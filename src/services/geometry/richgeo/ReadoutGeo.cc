@@ -32,15 +32,9 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, gsl::not_null<const dd4hep
   // capitalize m_detName
   std::transform(m_detName.begin(), m_detName.end(), m_detName.begin(), ::toupper);
 
-  // random number generators
-  m_random.SetSeed(1); // default seed
-
   // default (empty) cellID looper
   m_loopCellIDs = [] (std::function<void(CellIDType)> lambda) { return; };
 
-  // default (empty) cellID rng generator
-  m_rngCellIDs = [] (std::function<void(CellIDType)> lambda, float p) { return; };
-
   // common objects
   m_readoutCoder = m_det->readout(m_detName+"Hits").idSpec().decoder();
   m_detRich      = m_det->detector(m_detName);
@@ -56,53 +50,54 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, gsl::not_null<const dd4hep
     m_num_px            = m_det->constant<int>("DRICH_num_px");
     m_pixel_size        = m_det->constant<double>("DRICH_pixel_size") / dd4hep::mm;
 
+    // list all readout pixels, and precompute each sensor's transformation
+    m_x_field     = m_readoutCoder->index("x");
+    m_y_field     = m_readoutCoder->index("y");
+    m_sensor_mask = ~((*m_readoutCoder)[m_x_field].mask() | (*m_readoutCoder)[m_y_field].mask());
+    for(auto const& [deName, detSensor] : m_detRich.children()) {
+      if(deName.find("sensor_de_sec")!=std::string::npos) {
+
+        // decode `sensorID` to module number and sector number
+        auto sensorID = detSensor.id();
+        auto ipdu     = m_readoutCoder->get(sensorID, "pdu");
+        auto isipm    = m_readoutCoder->get(sensorID, "sipm");
+        auto isec     = m_readoutCoder->get(sensorID, "sector");
+        // m_log->trace("  module: sensorID={:#018X} => ipdu={:<6} isipm={:<6} isec={:<2} name={}", sensorID, ipdu, isipm, isec, deName);
+
+        // loop over xy-segmentation
+        for (int x = 0; x < m_num_px; x++)
+          for (int y = 0; y < m_num_px; y++)
+            m_cellIDs.push_back(cellIDEncoding(isec, ipdu, isipm, x, y));
+
+        // sensor transformation, and local pixel positions, assuming a `CartesianGridXY` segmentation
+        auto transform = GetSensorTransform(cellIDEncoding(isec, ipdu, isipm, 0, 0));
+        auto pixel_local_xy = [&] (int x, int y) {
+          auto pos = ToSensorLocal(transform, m_conv->position(cellIDEncoding(isec, ipdu, isipm, x, y)));
+          return std::array<double,2>{ pos.x(), pos.y() };
+        };
+        transform.pixel_origin = pixel_local_xy(0, 0);
+        transform.pixel_step_x = { 0.0, 0.0 };
+        transform.pixel_step_y = { 0.0, 0.0 };
+        if(m_num_px > 1) {
+          auto pixel_x = pixel_local_xy(1, 0);
+          auto pixel_y = pixel_local_xy(0, 1);
+          for(int i = 0; i < 2; i++) {
+            transform.pixel_step_x[i] = pixel_x[i] - transform.pixel_origin[i];
+            transform.pixel_step_y[i] = pixel_y[i] - transform.pixel_origin[i];
+          }
+        }
+        m_sensor_transform_index.insert({ cellIDEncoding(isec, ipdu, isipm, 0, 0) & m_sensor_mask, m_sensor_transforms.size() });
+        m_sensor_transforms.push_back(transform);
+      }
+    } // end sensor loop (for all sectors)
+    m_log->debug("{} readout: {} sensors, {} pixels", m_detName, m_sensor_transforms.size(), m_cellIDs.size());
+
     // define cellID looper
     m_loopCellIDs = [this] (std::function<void(CellIDType)> lambda) {
       m_log->trace("call VisitAllReadoutPixels for systemID = {} = {}", m_systemID, m_detName);
-
-      // loop over sensors (for all sectors)
-      for(auto const& [deName, detSensor] : m_detRich.children()) {
-        if(deName.find("sensor_de_sec")!=std::string::npos) {
-
-          // decode `sensorID` to module number and sector number
-          auto sensorID = detSensor.id();
-          auto ipdu     = m_readoutCoder->get(sensorID, "pdu");
-          auto isipm    = m_readoutCoder->get(sensorID, "sipm");
-          auto isec     = m_readoutCoder->get(sensorID, "sector");
-          // m_log->trace("  module: sensorID={:#018X} => ipdu={:<6} isipm={:<6} isec={:<2} name={}", sensorID, ipdu, isipm, isec, deName);
-
-          // loop over xy-segmentation
-          for (int x = 0; x < m_num_px; x++) {
-            for (int y = 0; y < m_num_px; y++) {
-
-              auto cellID = cellIDEncoding(isec, ipdu, isipm, x, y);
-
-              // then execute the user's lambda function
-              lambda(cellID);
-            }
-          } // end xy-segmentation loop
-        }
-      } // end sensor loop (for all sectors)
-    }; // end definition of m_loopCellIDs
-
-    // define k random cell IDs generator
-    m_rngCellIDs = [this] (std::function<void(CellIDType)> lambda, float p) {
-      m_log->trace("call RngReadoutPixels for systemID = {} = {}", m_systemID, m_detName);
-
-      int k = p * m_num_sec * m_num_pdus * m_num_sipms_per_pdu * m_num_px * m_num_px;
-
-      for (int i = 0; i < k; i++) {
-        int isec = m_random.Uniform(0., m_num_sec);
-        int ipdu = m_random.Uniform(0., m_num_pdus);
-        int isipm = m_random.Uniform(0., m_num_sipms_per_pdu);
-        int x = m_random.Uniform(0., m_num_px);
-        int y = m_random.Uniform(0., m_num_px);
-
-        auto cellID = cellIDEncoding(isec, ipdu, isipm, x, y);
-
+      for(auto cellID : m_cellIDs)
         lambda(cellID);
-      }
-    };
+    }; // end definition of m_loopCellIDs
 
   }
 
@@ -120,9 +115,24 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, gsl::not_null<const dd4hep
 // pixel gap mask
 // FIXME: generalize; this assumes the segmentation is `CartesianGridXY`
 bool richgeo::ReadoutGeo::PixelGapMask(CellIDType cellID, dd4hep::Position pos_hit_global) {
-  auto pos_pixel_global = m_conv->position(cellID);
-  auto pos_pixel_local  = GetSensorLocalPosition(cellID, pos_pixel_global);
-  auto pos_hit_local    = GetSensorLocalPosition(cellID, pos_hit_global);
+  dd4hep::Position pos_pixel_local, pos_hit_local;
+  auto transform_it = m_sensor_transform_index.find(cellID & m_sensor_mask);
+  if(transform_it != m_sensor_transform_index.end()) {
+    const auto& transform = m_sensor_transforms[transform_it->second];
+    auto x = static_cast<double>(m_readoutCoder->get(cellID, m_x_field));
+    auto y = static_cast<double>(m_readoutCoder->get(cellID, m_y_field));
+    pos_pixel_local.SetXYZ(
+        transform.pixel_origin[0] + x * transform.pixel_step_x[0] + y * transform.pixel_step_y[0],
+        transform.pixel_origin[1] + x * transform.pixel_step_x[1] + y * transform.pixel_step_y[1],
+        0.0
+        );
+    pos_hit_local = ToSensorLocal(transform, pos_hit_global);
+  }
+  else {
+    // not a precomputed sensor; look up the geometry
+    pos_pixel_local = GetSensorLocalPosition(cellID, m_conv->position(cellID));
+    pos_hit_local   = GetSensorLocalPosition(cellID, pos_hit_global);
+  }
   return ! (
       std::abs( pos_hit_local.x()/dd4hep::mm - pos_pixel_local.x()/dd4hep::mm ) > m_pixel_size/2 ||
       std::abs( pos_hit_local.y()/dd4hep::mm - pos_pixel_local.y()/dd4hep::mm ) > m_pixel_size/2
@@ -133,13 +143,18 @@ bool richgeo::ReadoutGeo::PixelGapMask(CellIDType cellID, dd4hep::Position pos_h
 // transform global position `pos` to sensor `cellID` frame position
 // IMPORTANT NOTE: this has only been tested for the dRICH; if you use it, test it carefully...
 dd4hep::Position richgeo::ReadoutGeo::GetSensorLocalPosition(CellIDType cellID, dd4hep::Position pos) {
+  return ToSensorLocal(GetSensorTransform(cellID), pos);
+}
+
+
+// get the transformation of the sensor of `cellID`
+richgeo::ReadoutGeo::SensorTransform richgeo::ReadoutGeo::GetSensorTransform(CellIDType cellID) {
 
   // get the VolumeManagerContext for this sensitive detector
   auto context = m_conv->findContext(cellID);
 
   // transformation vector buffers
   double xyz_l[3], xyz_e[3], xyz_g[3];
-  double pv_g[3], pv_l[3];
 
   // get sensor position w.r.t. its parent
   auto sensor_elem = context->element;
@@ -150,33 +165,32 @@ dd4hep::Position richgeo::ReadoutGeo::GetSensorLocalPosition(CellIDType cellID,
   volToElement.LocalToMaster(xyz_l, xyz_e);
   const auto& elementToGlobal = sensor_elem.nominal().worldTransformation();
   elementToGlobal.LocalToMaster(xyz_e, xyz_g);
-  dd4hep::Position pos_sensor;
-  pos_sensor.SetCoordinates(xyz_g);
 
-  // get the position vector of `pos` w.r.t. the sensor position `pos_sensor`
-  dd4hep::Direction pos_pv = pos - pos_sensor;
+  // positions are transformed to the sensor's local frame with the rotation of `volToElement`
+  SensorTransform transform;
+  std::copy(xyz_g, xyz_g + 3, transform.position.begin());
+  const auto *rotation = volToElement.GetRotationMatrix();
+  std::copy(rotation, rotation + 9, transform.rotation.begin());
+  return transform;
+}
 
-  // then transform it to the sensor's local frame
-  pos_pv.GetCoordinates(pv_g);
-  volToElement.MasterToLocalVect(pv_g, pv_l);
-  dd4hep::Position pos_transformed;
-  pos_transformed.SetCoordinates(pv_l);
 
-  // trace log
-  /*
-  if(m_log->level() <= spdlog::level::trace) {
-    m_log->trace("pixel hit on cellID={:#018x}",cellID);
-    auto print_pos = [&] (std::string name, dd4hep::Position p) {
-      m_log->trace("  {:>30} x={:.2f} y={:.2f} z={:.2f} [mm]: ", name, p.x()/dd4hep::mm,  p.y()/dd4hep::mm,  p.z()/dd4hep::mm);
-    };
-    print_pos("input position",  pos);
-    print_pos("sensor position", pos_sensor);
-    print_pos("output position", pos_transformed);
-    // auto dim = m_conv->cellDimensions(cellID);
-    // for (std::size_t j = 0; j < std::size(dim); ++j)
-    //   m_log->trace("   - dimension {:<5} size: {:.2}",  j, dim[j]);
-  }
-  */
+// transform global position `pos` to the local frame of the sensor with transformation `transform`
+dd4hep::Position richgeo::ReadoutGeo::ToSensorLocal(const SensorTransform& transform, const dd4hep::Position& pos) const {
 
+  // get the position vector of `pos` w.r.t. the sensor position
+  double pv_g[3] = {
+    pos.x() - transform.position[0],
+    pos.y() - transform.position[1],
+    pos.z() - transform.position[2]
+  };
+
+  // then rotate it to the sensor's local frame (cf. `TGeoMatrix::MasterToLocalVect()`)
+  const auto& rot = transform.rotation;
+  double pv_l[3];
+  for(int i = 0; i < 3; i++)
+    pv_l[i] = pv_g[0]*rot[i] + pv_g[1]*rot[i+3] + pv_g[2]*rot[i+6];
+  dd4hep::Position pos_transformed;
+  pos_transformed.SetCoordinates(pv_l);
   return pos_transformed;
 }
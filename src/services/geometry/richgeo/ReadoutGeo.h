@@ -13,12 +13,15 @@
 #include <DDRec/CellIDPositionConverter.h>
 #include <DDSegmentation/BitFieldCoder.h>
 #include <Parsers/Primitives.h>
-#include <TRandomGen.h>
 #include <spdlog/logger.h>
+#include <array>
+#include <cstddef>
 #include <functional>
 #include <gsl/pointers>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 // local
 #include "RichGeo.h"
@@ -50,9 +53,6 @@ namespace richgeo {
       // loop over readout pixels, executing `lambda(cellID)` on each
       void VisitAllReadoutPixels(std::function<void(CellIDType)> lambda) { m_loopCellIDs(lambda); }
 
-      // generated k rng cell IDs, executing `lambda(cellID)` on each
-      void VisitAllRngPixels(std::function<void(CellIDType)> lambda, float p) { m_rngCellIDs(lambda, p); }
-
       // pixel gap mask
       bool PixelGapMask(CellIDType cellID, dd4hep::Position pos_hit_global);
 
@@ -60,8 +60,8 @@ namespace richgeo {
       // IMPORTANT NOTE: this has only been tested for the dRICH; if you use it, test it carefully...
       dd4hep::Position GetSensorLocalPosition(CellIDType id, dd4hep::Position pos);
 
-      // set RNG seed
-      void SetSeed(unsigned long seed) { m_random.SetSeed(seed); }
+      // all readout pixel cellIDs, in the order visited by `VisitAllReadoutPixels`; e.g., for noise generation
+      const std::vector<CellIDType>& GetCellIDs() const { return m_cellIDs; }
 
     protected:
 
@@ -79,15 +79,27 @@ namespace richgeo {
       int                    m_num_px;
       double                 m_pixel_size;
 
+      // sensor transformation, precomputed for each sensor, so that `PixelGapMask` needs no geometry lookups;
+      // lengths are in DD4hep units
+      struct SensorTransform {
+        std::array<double,3> position;     // sensor position, w.r.t. which local positions are taken
+        std::array<double,9> rotation;     // rotation matrix; local direction = rotation^T * global direction
+        std::array<double,2> pixel_origin; // local (x,y) position of pixel (0,0)
+        std::array<double,2> pixel_step_x; // change of local (x,y) position per pixel in x
+        std::array<double,2> pixel_step_y; // change of local (x,y) position per pixel in y
+      };
+      SensorTransform  GetSensorTransform(CellIDType cellID);
+      dd4hep::Position ToSensorLocal(const SensorTransform& transform, const dd4hep::Position& pos) const;
+
+      std::vector<SensorTransform>               m_sensor_transforms;
+      std::unordered_map<CellIDType,std::size_t> m_sensor_transform_index; // sensor bits of cellID -> index in `m_sensor_transforms`
+      CellIDType                                 m_sensor_mask = 0;        // cellID bits which identify the sensor
+      std::size_t                                m_x_field;                // readout field indices of the pixel x and y
+      std::size_t                                m_y_field;
+      std::vector<CellIDType>                    m_cellIDs;                // all readout pixels
+
       // local function to loop over cellIDs; defined in initialization and called by `VisitAllReadoutPixels`
       std::function< void(std::function<void(CellIDType)>) > m_loopCellIDs;
-      // local function to generate rng cellIDs; defined in initialization and called by `VisitAllRngPixels`
-      std::function< void(std::function<void(CellIDType)>, float) > m_rngCellIDs;
-
-    private:
-
-      // random number generators
-      TRandomMixMax m_random;
 
   };
 }
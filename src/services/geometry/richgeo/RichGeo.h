@@ -22,6 +22,7 @@ namespace richgeo {
       Sensor() {};
       ~Sensor() {};
       double            size;
+      int               sector = 0;
       dd4hep::Position  surface_centroid;
       dd4hep::Direction surface_offset; // surface centroid = volume centroid + `surface_offset`
   };
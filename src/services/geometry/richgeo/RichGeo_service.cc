@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <exception>
 #include <gsl/pointers>
+#include <memory>
 
 #include "extensions/spdlog/SpdlogExtensions.h"
 #include "services/geometry/dd4hep/DD4hep_service.h"
@@ -44,13 +45,7 @@ richgeo::IrtGeo *RichGeo_service::GetIrtGeo(std::string detector_name) {
   try {
     m_log->debug("Call RichGeo_service::GetIrtGeo initializer");
     auto initialize = [this,&detector_name] () {
-      if(!m_dd4hepGeo) throw JException("RichGeo_service m_dd4hepGeo==null which should never be!");
-      // instantiate IrtGeo-derived object, depending on detector
-      auto which_rich = detector_name;
-      std::transform(which_rich.begin(), which_rich.end(), which_rich.begin(), ::toupper);
-      if     ( which_rich=="DRICH"  ) m_irtGeo = new richgeo::IrtGeoDRICH(m_dd4hepGeo,  m_converter, m_log);
-      else if( which_rich=="PFRICH" ) m_irtGeo = new richgeo::IrtGeoPFRICH(m_dd4hepGeo, m_converter, m_log);
-      else throw JException(fmt::format("IrtGeo is not defined for detector '{}'",detector_name));
+      m_irtGeo = MakeIrtGeo(detector_name).release();
     };
     std::call_once(m_init_irt, initialize);
   }
@@ -61,6 +56,16 @@ richgeo::IrtGeo *RichGeo_service::GetIrtGeo(std::string detector_name) {
   return m_irtGeo;
 }
 
+std::unique_ptr<richgeo::IrtGeo> RichGeo_service::MakeIrtGeo(std::string detector_name) {
+  if(!m_dd4hepGeo) throw JException("RichGeo_service m_dd4hepGeo==null which should never be!");
+  // instantiate IrtGeo-derived object, depending on detector
+  auto which_rich = detector_name;
+  std::transform(which_rich.begin(), which_rich.end(), which_rich.begin(), ::toupper);
+  if     ( which_rich=="DRICH"  ) return std::make_unique<richgeo::IrtGeoDRICH>(m_dd4hepGeo,  m_converter, m_log);
+  else if( which_rich=="PFRICH" ) return std::make_unique<richgeo::IrtGeoPFRICH>(m_dd4hepGeo, m_converter, m_log);
+  else throw JException(fmt::format("IrtGeo is not defined for detector '{}'",detector_name));
+}
+
 // ActsGeo -----------------------------------------------------------
 richgeo::ActsGeo *RichGeo_service::GetActsGeo(std::string detector_name) {
   // initialize, if not yet initialized
@@ -30,6 +30,9 @@ class RichGeo_service : public JService {
     virtual richgeo::ActsGeo *GetActsGeo(std::string detector_name);
     virtual std::shared_ptr<richgeo::ReadoutGeo> GetReadoutGeo(std::string detector_name);
 
+    // return a new IrtGeo, not shared with anyone else, e.g., for a worker thread which needs its own IRT state
+    virtual std::unique_ptr<richgeo::IrtGeo> MakeIrtGeo(std::string detector_name);
+
   private:
     RichGeo_service() = default;
     void acquire_services(JServiceLocator *) override;
@@ -210,6 +210,16 @@ JEventProcessorPODIO::JEventProcessorPODIO() {
             m_collections_to_print,
             "Comma separated list of collection names to print to screen, e.g. for debugging."
     );
+    japp->SetDefaultParameter(
+            "podio:output_ordered",
+            m_output_ordered,
+            "Write events in the order in which they enter the processor (true), or as soon as they are ready (false). Ordering holds ready events back until the ones which entered before them are ready."
+    );
+    japp->SetDefaultParameter(
+            "podio:output_queue_depth",
+            m_output_queue_depth,
+            "Number of events which may wait for the writer thread. Events are handed over without waiting for them to be written, unless the queue is full."
+    );
 
     m_output_include_collections = std::set<std::string>(output_include_collections.begin(),
                                                          output_include_collections.end());
@@ -219,6 +229,19 @@ JEventProcessorPODIO::JEventProcessorPODIO() {
 }
 
 
+JEventProcessorPODIO::~JEventProcessorPODIO() {
+    // Normally done in Finish(), but never leave the writer thread running
+    if (m_writer_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_closing = true;
+        }
+        m_queue_cv.notify_all();
+        m_writer_thread.join();
+    }
+}
+
+
 void JEventProcessorPODIO::Init() {
 
     auto *app = GetApplication();
@@ -228,6 +251,7 @@ void JEventProcessorPODIO::Init() {
     // TODO: NWB: Verify that output file is writable NOW, rather than after event processing completes.
     //       I definitely don't trust PODIO to do this for me.
 
+    m_writer_thread = std::thread(&JEventProcessorPODIO::WriterLoop, this);
 }
 
 
@@ -270,53 +294,7 @@ void JEventProcessorPODIO::FindCollectionsToWrite(const std::shared_ptr<const JE
 
 }
 
-void JEventProcessorPODIO::Process(const std::shared_ptr<const JEvent> &event) {
-
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (m_is_first_event) {
-        FindCollectionsToWrite(event);
-    }
-
-    // Trigger all collections once to fix the collection IDs
-    // TODO: WDC: This should not be necessary, but while we await collection IDs
-    //            that are determined by hash, we have to ensure they are reproducible
-    //            even if the collections are filled in unpredictable order (or not at
-    //            all). See also below, at "TODO: NWB:".
-    for (const auto& coll_name : m_collections_to_write) {
-        try {
-            [[maybe_unused]]
-            const auto* coll_ptr = event->GetCollectionBase(coll_name);
-        }
-        catch(std::exception &e) {
-            // chomp
-        }
-    }
-
-    // Print the contents of some collections, just for debugging purposes
-    // Do this before writing just in case writing crashes
-    if (!m_collections_to_print.empty()) {
-        LOG << "========================================" << LOG_END;
-        LOG << "JEventProcessorPODIO: Event " << event->GetEventNumber() << LOG_END;
-    }
-    for (const auto& coll_name : m_collections_to_print) {
-        LOG << "------------------------------" << LOG_END;
-        LOG << coll_name << LOG_END;
-        try {
-            const auto* coll_ptr = event->GetCollectionBase(coll_name);
-            if (coll_ptr == nullptr) {
-                LOG << "missing" << LOG_END;
-            } else {
-                coll_ptr->print();
-            }
-        }
-        catch(std::exception &e) {
-            LOG << "missing" << LOG_END;
-        }
-    }
-
-    m_log->trace("==================================");
-    m_log->trace("Event #{}", event->GetEventNumber());
-
+std::vector<std::string> JEventProcessorPODIO::ActivateCollections(const std::shared_ptr<const JEvent>& event, const std::vector<std::string>& collections) {
 
     // Make sure that all factories get called that need to be written into the frame.
     // We need to do this for _all_ factories unless we've constrained it by using includes/excludes.
@@ -337,8 +315,7 @@ void JEventProcessorPODIO::Process(const std::shared_ptr<const JEvent> &event) {
     //            This means that the collection IDs are stable so the writer doesn't segfault.
     //            The better fix is to maintain a map of collection IDs, or just wait for PODIO to fix the bug.
     std::vector<std::string> successful_collections;
-    static std::set<std::string> failed_collections;
-    for (const std::string& coll : m_collections_to_write) {
+    for (const std::string& coll : collections) {
         try {
             m_log->trace("Ensuring factory for collection '{}' has been called.", coll);
             const auto* coll_ptr = event->GetCollectionBase(coll);
@@ -347,9 +324,9 @@ void JEventProcessorPODIO::Process(const std::shared_ptr<const JEvent> &event) {
                 // To avoid this, we treat this as a failing collection and omit from this point onwards.
                 // However, this code path is expected to be unreachable because any missing collection will be
                 // replaced with an empty collection in JFactoryPodioTFixed::Create.
-                if (failed_collections.count(coll) == 0) {
+                std::lock_guard<std::mutex> lock(m_failed_mutex);
+                if (m_failed_collections.insert(coll).second) {
                     m_log->error("Omitting PODIO collection '{}' because it is null", coll);
-                    failed_collections.insert(coll);
                 }
             }
             else {
@@ -359,32 +336,200 @@ void JEventProcessorPODIO::Process(const std::shared_ptr<const JEvent> &event) {
         }
         catch(std::exception &e) {
             // Limit printing warning to just once per factory
-            if (failed_collections.count(coll) == 0) {
+            std::lock_guard<std::mutex> lock(m_failed_mutex);
+            if (m_failed_collections.insert(coll).second) {
                 m_log->error("Omitting PODIO collection '{}' due to exception: {}.", coll, e.what());
-                failed_collections.insert(coll);
             }
         }
     }
-    m_collections_to_write = successful_collections;
+    return successful_collections;
+}
+
+void JEventProcessorPODIO::Process(const std::shared_ptr<const JEvent> &event) {
 
-    // Frame will contain data from all Podio factories that have been triggered,
-    // including by the `event->GetCollectionBase(coll);` above.
-    // Note that collections MUST be present in frame. If a collection is null, the writer will segfault.
-    const auto* frame = event->GetSingle<podio::Frame>();
+    // Each event draws exactly one ticket: here when the output is ordered (the order in
+    // which events enter here), or in Submit() otherwise (the order in which they are ready)
+    std::uint64_t ticket = 0;
+    if (m_output_ordered) {
+        ticket = m_next_ticket++;
+    }
+
+    WriteRequest request;
+    try {
+        // Factories run concurrently for different events, outside of any lock.
+        // Only the first event runs under the lock, as it fixes the collections
+        // that are written for all events.
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_is_first_event) {
+            FindCollectionsToWrite(event);
+            m_collections_to_write = ActivateCollections(event, m_collections_to_write);
+            m_is_first_event = false;
+            request.collections = m_collections_to_write;
+            lock.unlock();
+        } else {
+            request.collections = m_collections_to_write;
+            lock.unlock();
+
+            const auto successful_collections = ActivateCollections(event, request.collections);
+            if (successful_collections.size() != request.collections.size()) {
+                // omit failed collections from this point onwards
+                lock.lock();
+                m_collections_to_write.erase(
+                    std::remove_if(m_collections_to_write.begin(), m_collections_to_write.end(), [&](const std::string& coll) {
+                        return std::find(successful_collections.begin(), successful_collections.end(), coll) == successful_collections.end();
+                    }),
+                    m_collections_to_write.end());
+                lock.unlock();
+            }
+            request.collections = successful_collections;
+        }
+
+        // Print the contents of some collections, just for debugging purposes
+        // Do this before writing just in case writing crashes
+        if (!m_collections_to_print.empty()) {
+            lock.lock();
+            LOG << "========================================" << LOG_END;
+            LOG << "JEventProcessorPODIO: Event " << event->GetEventNumber() << LOG_END;
+            for (const auto& coll_name : m_collections_to_print) {
+                LOG << "------------------------------" << LOG_END;
+                LOG << coll_name << LOG_END;
+                try {
+                    const auto* coll_ptr = event->GetCollectionBase(coll_name);
+                    if (coll_ptr == nullptr) {
+                        LOG << "missing" << LOG_END;
+                    } else {
+                        coll_ptr->print();
+                    }
+                }
+                catch(std::exception &e) {
+                    LOG << "missing" << LOG_END;
+                }
+            }
+            lock.unlock();
+        }
+
+        m_log->trace("==================================");
+        m_log->trace("Event #{}", event->GetEventNumber());
+
+        // Frame will contain data from all Podio factories that have been triggered,
+        // including by the `event->GetCollectionBase(coll);` above.
+        // Note that collections MUST be present in frame. If a collection is null, the writer will segfault.
+        request.frame = TakeFrame(event);
+        if (request.frame == nullptr) {
+            throw JException(fmt::format("JEventProcessorPODIO: Event {} has no podio::Frame", event->GetEventNumber()));
+        }
+    }
+    catch(...) {
+        // do not hold up the events after this one; the frame is not written, but it is
+        // still taken, so that it is deleted whatever the ownership flag of the last event
+        request.frame = nullptr;
+        TakeFrame(event);
+        Submit(ticket, std::move(request));
+        throw;
+    }
 
     // TODO: NWB: We need to actively stabilize podio collections. Until then, keep this around in case
     //            the writer starts segfaulting, so we can quickly see whether the problem is unstable collection IDs.
     /*
-    m_log->info("Event {}: Writing {} collections", event->GetEventNumber(), m_collections_to_write.size());
-    for (const std::string& collname : m_collections_to_write) {
-        m_log->info("Writing collection '{}' with id {}", collname, frame->get(collname)->getID());
+    m_log->info("Event {}: Writing {} collections", event->GetEventNumber(), request.collections.size());
+    for (const std::string& collname : request.collections) {
+        m_log->info("Writing collection '{}' with id {}", collname, request.frame->get(collname)->getID());
     }
     */
-    m_writer->writeFrame(*frame, "events", m_collections_to_write);
-    m_is_first_event = false;
+    Submit(ticket, std::move(request));
+}
+
+std::shared_ptr<podio::Frame> JEventProcessorPODIO::TakeFrame(const std::shared_ptr<const JEvent>& event) {
+    // The frame is shared by the writer and a FrameKeepAlive in the event, and deleted by the
+    // last of the two: other processors may still read it, while the writer only fills the I/O
+    // buffers of its collections. The factories are reused with their event, so the ownership
+    // flag of the frame factory is set again for every event.
+    auto* keep_alive_factory = event->GetFactory<FrameKeepAlive>();
+    if (keep_alive_factory != nullptr && keep_alive_factory->GetNumObjects() > 0) {
+        // already taken for this event
+        return event->GetSingle<FrameKeepAlive>()->frame;
+    }
+    auto* frame_factory = event->GetFactory<podio::Frame>();
+    if (frame_factory == nullptr) {
+        return nullptr;
+    }
+    if (frame_factory->GetNumObjects() == 0) {
+        // a frame created later stays owned by the event
+        frame_factory->ClearFactoryFlag(JFactory::NOT_OBJECT_OWNER);
+        return nullptr;
+    }
+    frame_factory->SetFactoryFlag(JFactory::NOT_OBJECT_OWNER);
+    std::shared_ptr<podio::Frame> frame(const_cast<podio::Frame*>(event->GetSingle<podio::Frame>()));
+    event->Insert(new FrameKeepAlive{frame});
+    return frame;
+}
 
+void JEventProcessorPODIO::Submit(std::uint64_t ticket, WriteRequest&& request) {
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    if (!m_output_ordered) {
+        // written in the order of arrival; drawn under the lock, so tickets enter the queue in order
+        ticket = m_next_ticket++;
+    }
+
+    // Back-pressure: wait while the queue is full. The tickets within the depth of the next
+    // one to write are always admitted, so the event the writer waits for is never blocked.
+    const std::size_t depth = std::max<std::size_t>(m_output_queue_depth, 1);
+    m_queue_cv.wait(lock, [this, ticket, depth] { return ticket < m_next_to_write + depth; });
+    m_queue.emplace(ticket, std::move(request));
+    m_queue_cv.notify_all();
+
+    if (m_write_error) {
+        std::rethrow_exception(m_write_error);
+    }
+}
+
+void JEventProcessorPODIO::WriterLoop() {
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    while (true) {
+        m_queue_cv.wait(lock, [this] {
+            return m_closing || (!m_queue.empty() && m_queue.begin()->first == m_next_to_write);
+        });
+        if (m_queue.empty()) {
+            // closing, and every event has been written
+            break;
+        }
+        auto it = m_queue.begin();
+        m_next_to_write = it->first + 1;
+        WriteRequest request = std::move(it->second);
+        m_queue.erase(it);
+        m_queue_cv.notify_all();
+        if (request.frame == nullptr) {
+            continue;
+        }
+
+        // Serialization and compression happen here, while workers keep processing other events
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            m_writer->writeFrame(*request.frame, "events", request.collections);
+        }
+        catch(...) {
+            error = std::current_exception();
+        }
+        request.frame.reset();
+        lock.lock();
+        if (error && !m_write_error) {
+            m_write_error = error;
+        }
+    }
 }
 
 void JEventProcessorPODIO::Finish() {
+    if (m_writer_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_closing = true;
+        }
+        m_queue_cv.notify_all();
+        m_writer_thread.join();
+    }
     m_writer->finish();
+    if (m_write_error) {
+        std::rethrow_exception(m_write_error);
+    }
 }
@@ -3,12 +3,20 @@
 
 #include <JANA/JEvent.h>
 #include <JANA/JEventProcessor.h>
+#include <podio/Frame.h>
 #include <podio/ROOTFrameWriter.h>
 #include <spdlog/logger.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 
@@ -17,7 +25,7 @@ class JEventProcessorPODIO : public JEventProcessor {
 public:
 
     JEventProcessorPODIO();
-    virtual ~JEventProcessorPODIO() = default;
+    virtual ~JEventProcessorPODIO();
 
     void Init() override;
     void Process(const std::shared_ptr<const JEvent>& event) override;
@@ -25,9 +33,47 @@ public:
 
     void FindCollectionsToWrite(const std::shared_ptr<const JEvent>& event);
 
+    /// Run the factories of the given collections, return the ones that could be created
+    std::vector<std::string> ActivateCollections(const std::shared_ptr<const JEvent>& event, const std::vector<std::string>& collections);
+
+    /// A frame waiting for the writer thread. The frame is shared with its event until the
+    /// event is recycled, so that other processors can still read it, see TakeFrame().
+    struct WriteRequest {
+        std::shared_ptr<podio::Frame> frame;
+        std::vector<std::string> collections;
+    };
+
+    /// Holds the event's reference to its frame, released when the event is recycled
+    struct FrameKeepAlive {
+        std::shared_ptr<podio::Frame> frame;
+    };
+
+    /// Take the frame of the event out of the event's ownership, or null if it has none
+    std::shared_ptr<podio::Frame> TakeFrame(const std::shared_ptr<const JEvent>& event);
+
+    /// Queue a request for the writer thread, and return once it is queued. Blocks only while
+    /// the queue is full. A request without a frame only releases its ticket.
+    void Submit(std::uint64_t ticket, WriteRequest&& request);
+    void WriterLoop();
+
     std::unique_ptr<podio::ROOTFrameWriter> m_writer;
     std::mutex m_mutex;
     bool m_is_first_event = true;
+
+    // Serialization stage, on a dedicated thread
+    bool m_output_ordered = false;
+    std::size_t m_output_queue_depth = 16;
+    std::atomic<std::uint64_t> m_next_ticket{0};  // one ticket per event, starting at m_next_to_write
+    std::thread m_writer_thread;
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_cv;
+    std::map<std::uint64_t, WriteRequest> m_queue;
+    std::uint64_t m_next_to_write = 0;            // the first ticket issued
+    bool m_closing = false;
+    std::exception_ptr m_write_error;             // first failed write, rethrown to the workers
+
+    std::mutex m_failed_mutex;
+    std::set<std::string> m_failed_collections;
     bool m_user_included_collections = false;
     std::shared_ptr<spdlog::logger> m_log;
 
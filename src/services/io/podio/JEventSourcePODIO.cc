@@ -92,6 +92,24 @@ JEventSourcePODIO::JEventSourcePODIO(std::string resource_name, JApplication* ap
             "Print list of collection names and their types"
             );
 
+    // Collections that are not selected are not inserted into the event. This is a filter on the
+    // collection names only: an excluded collection may still be unpacked by the frame when a
+    // selected collection has relations into it
+    std::vector<std::string> input_include_collections;
+    std::vector<std::string> input_exclude_collections;
+    GetApplication()->SetDefaultParameter(
+            "podio:input_include_collections",
+            input_include_collections,
+            "Comma separated list of collection names to insert into the event. If not set, all collections in the file are inserted."
+            );
+    GetApplication()->SetDefaultParameter(
+            "podio:input_exclude_collections",
+            input_exclude_collections,
+            "Comma separated list of collection names to not insert into the event."
+            );
+    m_INPUT_INCLUDE_COLLECTIONS = std::set<std::string>(input_include_collections.begin(), input_include_collections.end());
+    m_INPUT_EXCLUDE_COLLECTIONS = std::set<std::string>(input_exclude_collections.begin(), input_exclude_collections.end());
+
     // Hopefully we won't need to reimplement background event merging. Using podio frames, it looks like we would
     // have to do a deep copy of all data in order to insert it into the same frame, which would probably be
     // quite inefficient.
@@ -217,8 +235,12 @@ void JEventSourcePODIO::GetEvent(std::shared_ptr<JEvent> event) {
     event->SetRunNumber(event_headers[0].getRunNumber());
 
     // Insert contents odf frame into JFactories
+    // Only the selected collections are requested from the frame, but resolving their relations may unpack others
     VisitPodioCollection<InsertingVisitor> visit;
     for (const std::string& coll_name : frame->getAvailableCollections()) {
+        if (!IsCollectionSelected(coll_name)) {
+            continue;
+        }
         const podio::CollectionBase* collection = frame->get(coll_name);
         InsertingVisitor visitor(*event, coll_name);
         visit(visitor, *collection);
@@ -228,6 +250,24 @@ void JEventSourcePODIO::GetEvent(std::shared_ptr<JEvent> event) {
     Nevents_read += 1;
 }
 
+//------------------------------------------------------------------------------
+// IsCollectionSelected
+//
+/// Apply the podio:input_include_collections and podio:input_exclude_collections
+/// lists. The event header is always selected, since it is needed to set up the event.
+///
+/// \param collection_name name of the collection in the file
+//------------------------------------------------------------------------------
+bool JEventSourcePODIO::IsCollectionSelected(const std::string& collection_name) const {
+    if (collection_name == "EventHeader") {
+        return true;
+    }
+    if (!m_INPUT_INCLUDE_COLLECTIONS.empty() && m_INPUT_INCLUDE_COLLECTIONS.count(collection_name) == 0) {
+        return false;
+    }
+    return m_INPUT_EXCLUDE_COLLECTIONS.count(collection_name) == 0;
+}
+
 //------------------------------------------------------------------------------
 // GetDescription
 //------------------------------------------------------------------------------
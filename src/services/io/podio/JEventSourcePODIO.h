@@ -36,10 +36,11 @@ protected:
     size_t Nevents_in_file = 0;
     size_t Nevents_read = 0;
 
-    std::string m_include_collections_str;
-    std::string m_exclude_collections_str;
     std::set<std::string> m_INPUT_INCLUDE_COLLECTIONS;
     std::set<std::string> m_INPUT_EXCLUDE_COLLECTIONS;
+
+    /// Whether a collection from the file is to be inserted into the event
+    bool IsCollectionSelected(const std::string& collection_name) const;
     bool m_run_forever=false;
 
 };
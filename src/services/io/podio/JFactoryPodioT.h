@@ -8,6 +8,7 @@
 #include <JANA/JFactoryT.h>
 #include <JANA/JEvent.h>
 #include <podio/Frame.h>
+#include <vector>
 #include "datamodel_glue.h"
 
 
@@ -20,8 +21,11 @@ public:
 private:
     // mCollection is owned by the frame.
     // mFrame is owned by the JFactoryT<podio::Frame>.
-    // mData holds lightweight value objects which hold a pointer into mCollection.
-    // This factory owns these value objects.
+    // mData holds pointers to lightweight value objects which hold a pointer into mCollection.
+    // The value objects live in mStorage, which this factory owns. mStorage is sized once per
+    // collection, so the pointers stay valid until ClearData(), and its capacity is reused
+    // between events, so there is no allocation per object.
+    std::vector<T> mStorage;
 
 public:
     explicit JFactoryPodioT();
@@ -52,6 +56,9 @@ private:
     friend class JEvent;
     void SetCollectionAlreadyInFrame(const CollectionT* collection);
 
+    // Point mData at value objects for every element of the collection
+    void SetData(const CollectionT& collection);
+
 };
 
 
@@ -74,11 +81,7 @@ void JFactoryPodioT<T>::SetCollection(typename PodioTypeMap<T>::collection_t&& c
     }
     const auto& moved = this->mFrame->put(std::move(collection), this->GetTag());
     this->mCollection = &moved;
-
-    for (const T& item : moved) {
-        T* clone = new T(item);
-        this->mData.push_back(clone);
-    }
+    SetData(moved);
     this->mStatus = JFactory::Status::Inserted;
     this->mCreationStatus = JFactory::CreationStatus::Inserted;
 }
@@ -95,11 +98,7 @@ void JFactoryPodioT<T>::SetCollection(std::unique_ptr<typename PodioTypeMap<T>::
     this->mFrame->put(std::move(collection), this->GetTag());
     const auto* moved = &this->mFrame->template get<typename PodioTypeMap<T>::collection_t>(this->GetTag());
     this->mCollection = moved;
-
-    for (const T& item : *moved) {
-        T* clone = new T(item);
-        this->mData.push_back(clone);
-    }
+    SetData(*moved);
     this->mStatus = JFactory::Status::Inserted;
     this->mCreationStatus = JFactory::CreationStatus::Inserted;
 }
@@ -107,12 +106,12 @@ void JFactoryPodioT<T>::SetCollection(std::unique_ptr<typename PodioTypeMap<T>::
 
 template <typename T>
 void JFactoryPodioT<T>::ClearData() {
-    for (auto p : this->mData) {
+    for (T& item : mStorage) {
         // Avoid potentially invalid call to ObjBase::release(). The frame and
         // all the collections and all Obj may have been deallocated at this point.
-        p->unlink();
-        delete p;
+        item.unlink();
     }
+    mStorage.clear();
     this->mData.clear();
     this->mCollection = nullptr;  // Collection is owned by the Frame, so we ignore here
     this->mFrame = nullptr;  // Frame is owned by the JEvent, so we ignore here
@@ -125,15 +124,32 @@ void JFactoryPodioT<T>::ClearData() {
 
 template <typename T>
 void JFactoryPodioT<T>::SetCollectionAlreadyInFrame(const CollectionT* collection) {
-    for (const T& item : *collection) {
-        T* clone = new T(item);
-        this->mData.push_back(clone);
-    }
+    SetData(*collection);
     this->mCollection = collection;
     this->mStatus = JFactory::Status::Inserted;
     this->mCreationStatus = JFactory::CreationStatus::Inserted;
 }
 
+template <typename T>
+void JFactoryPodioT<T>::SetData(const CollectionT& collection) {
+    // podio collections store Obj pointers and hand out value objects on access, so there
+    // is no array of T inside the collection to point at. All value objects go into one
+    // buffer instead, reserved up front so that no reallocation moves them.
+    for (T& item : mStorage) {
+        item.unlink();
+    }
+    mStorage.clear();
+    mStorage.reserve(collection.size());
+    for (const T& item : collection) {
+        mStorage.push_back(item);
+    }
+    this->mData.clear();
+    this->mData.reserve(mStorage.size());
+    for (T& item : mStorage) {
+        this->mData.push_back(&item);
+    }
+}
+
 template <typename T>
 void JFactoryPodioT<T>::Create(const std::shared_ptr<const JEvent>& event) {
     mFrame = GetOrCreateFrame(event);
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include <DD4hep/IDDescriptor.h>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "algorithms/calorimetry/AdjacencyMatrixExpression.h"
+
+using eicrecon::AdjacencyMatrixExpression;
+
+namespace {
+
+  // the previous implementation compiled the expression with Cling, as C++ code in which every
+  // readout field was a `double` variable; the references below are that same C++ code
+  using std::abs;
+  using std::fabs;
+  using std::floor;
+  using std::fmod;
+  using std::max;
+  using std::min;
+
+  using Cell = std::vector<std::pair<std::string, int>>;
+
+  double value(const Cell& cell, const std::string& name) {
+    for (const auto& [field, val] : cell) {
+      if (field == name) {
+        return val;
+      }
+    }
+    throw std::out_of_range(name);
+  }
+
+  // all combinations of the given field values
+  std::vector<Cell> all_cells(const std::vector<std::pair<std::string, std::vector<int>>>& field_values) {
+    std::vector<Cell> cells{{}};
+    for (const auto& [field, values] : field_values) {
+      std::vector<Cell> extended;
+      for (const auto& cell : cells) {
+        for (int val : values) {
+          extended.push_back(cell);
+          extended.back().emplace_back(field, val);
+        }
+      }
+      cells = std::move(extended);
+    }
+    return cells;
+  }
+
+  // compare the compiled expression with `reference` on all pairs of cells; returns the number of adjacent pairs
+  std::size_t compare_with_reference(
+      const std::string& expression,
+      const dd4hep::IDDescriptor& id_desc,
+      const std::vector<Cell>& cells,
+      const std::function<bool(const Cell&, const Cell&)>& reference) {
+    AdjacencyMatrixExpression adjacency(expression, id_desc);
+    std::size_t num_adjacent = 0;
+    for (const auto& c1 : cells) {
+      for (const auto& c2 : cells) {
+        const bool expected = reference(c1, c2);
+        CAPTURE(c1, c2);
+        CHECK(adjacency(id_desc.encode(c1), id_desc.encode(c2)) == expected);
+        num_adjacent += expected;
+      }
+    }
+    return num_adjacent;
+  }
+
+} // namespace
+
+TEST_CASE( "adjacency matrix operators and functions match C++", "[AdjacencyMatrixExpression]" ) {
+  dd4hep::IDDescriptor id_desc("MockCalorimeterHits", "system:8,x:8,y:-8");
+  const std::vector<int> xs{0, 1, 2, 3, 7, 10};
+  const std::vector<int> ys{-3, -1, 0, 2, 5};
+
+  // the expression, as text for the compiler and as C++ for the reference
+#define CHECK_EXPRESSION(...)                                                                     \
+  for (int ix1 : xs) for (int ix2 : xs) for (int iy1 : ys) for (int iy2 : ys) {                   \
+    [[maybe_unused]] const double x_1 = ix1, x_2 = ix2, y_1 = iy1, y_2 = iy2;                     \
+    AdjacencyMatrixExpression adjacency(#__VA_ARGS__, id_desc);                                   \
+    CAPTURE(#__VA_ARGS__, ix1, ix2, iy1, iy2);                                                    \
+    CHECK(adjacency(id_desc.encode({{"system", 1}, {"x", ix1}, {"y", iy1}}),                       \
+                    id_desc.encode({{"system", 1}, {"x", ix2}, {"y", iy2}}))                       \
+          == static_cast<bool>(__VA_ARGS__));                                                     \
+  }
+
+  SECTION( "arithmetic and comparisons" ) {
+    CHECK_EXPRESSION(abs(x_1 - x_2) + abs(y_1 - y_2) == 1)
+    CHECK_EXPRESSION(x_1 - x_2 * 2 + 1 < y_1 - y_2)
+    CHECK_EXPRESSION(-x_1 / 2 >= y_1 / 3)
+    CHECK_EXPRESSION(x_1 * y_2 != x_2 * y_1)
+    CHECK_EXPRESSION((x_1 <= x_2 && !(y_1 > y_2)) || x_1 == 3)
+  }
+
+  SECTION( "functions" ) {
+    CHECK_EXPRESSION(fmod(x_1, 3) == fmod(x_2, 3))
+    CHECK_EXPRESSION(fmod(y_1, 2) == -1)
+    CHECK_EXPRESSION(floor(x_1 / 4) == floor(x_2 / 4))
+    CHECK_EXPRESSION(floor(y_1 / 2) + 1 == floor(y_2 / 2))
+    CHECK_EXPRESSION(min(x_1, x_2) - max(y_1, y_2) > 2)
+    CHECK_EXPRESSION(min(abs(x_1 - x_2), 12 - abs(x_1 - x_2)) == 1)
+    CHECK_EXPRESSION(abs(y_1) + fabs(y_2) == 3)
+    CHECK_EXPRESSION(std::abs(y_1 - y_2) == 2)
+  }
+
+  SECTION( "integer literals" ) {
+    // integer subexpressions have C++ integer semantics, fields are doubles
+    CHECK_EXPRESSION(x_1 + 7 / 2 == x_2)
+    CHECK_EXPRESSION(x_1 + 7.0 / 2 == x_2 + 0.5)
+    CHECK_EXPRESSION(x_1 / 2 == x_2 - 1.5)
+    CHECK_EXPRESSION(y_1 - -7 / 2 == y_2)
+    CHECK_EXPRESSION(x_1 + 7 % 3 == x_2)
+    CHECK_EXPRESSION(abs(x_1 - x_2) == (32 * 2 * 5) / 100)
+    CHECK_EXPRESSION(abs(y_1 - y_2) == min(1 / 2, 1) + max(-3, 2))
+    CHECK_EXPRESSION(abs(y_1 - y_2) == abs(1 - 4) - 1e0)
+  }
+
+#undef CHECK_EXPRESSION
+
+  SECTION( "invalid expressions" ) {
+    CHECK_THROWS_AS(AdjacencyMatrixExpression("z_1 == z_2", id_desc), std::runtime_error);
+    CHECK_THROWS_AS(AdjacencyMatrixExpression("x == 1", id_desc), std::runtime_error);
+    CHECK_THROWS_AS(AdjacencyMatrixExpression("hypot(x_1, x_2) == 1", id_desc), std::runtime_error);
+    CHECK_THROWS_AS(AdjacencyMatrixExpression("x_1 % 2 == 0", id_desc), std::runtime_error);
+    CHECK_THROWS_AS(AdjacencyMatrixExpression("(x_1 == x_2", id_desc), std::runtime_error);
+    CHECK_THROWS_AS(AdjacencyMatrixExpression("x_1 == 1 / 0", id_desc), std::runtime_error);
+  }
+}
+
+TEST_CASE( "detector adjacency matrices match C++", "[AdjacencyMatrixExpression]" ) {
+
+  SECTION( "EEMC" ) {
+    // src/detectors/EEMC/EEMC.cc
+    dd4hep::IDDescriptor id_desc("EcalEndcapNHits", "system:8,sector:4,module:8,row:8,column:8");
+    auto cells = all_cells({{"system", {1}}, {"sector", {0}}, {"module", {0}}, {"row", {0, 1, 2, 3}}, {"column", {0, 1, 2, 3}}});
+    auto num_adjacent = compare_with_reference(
+        "(abs(row_1 - row_2) + abs(column_1 - column_2)) == 1", id_desc, cells,
+        [](const Cell& c1, const Cell& c2) {
+          double row_1 = value(c1, "row"), row_2 = value(c2, "row");
+          double column_1 = value(c1, "column"), column_2 = value(c2, "column");
+          return (abs(row_1 - row_2) + abs(column_1 - column_2)) == 1;
+        });
+    // 4x4 grid: 2 * (3 * 4 + 4 * 3) ordered pairs of neighbours
+    CHECK(num_adjacent == 48);
+  }
+
+  SECTION( "LUMISPECCAL" ) {
+    // src/detectors/LUMISPECCAL/LUMISPECCAL.cc
+    dd4hep::IDDescriptor id_desc("LumiSpecCALHits", "system:8,sector:8,module:8,fiber_x:8,fiber_y:8");
+    auto cells = all_cells({{"system", {1}}, {"sector", {0, 1}}, {"module", {0, 1, 9, 10, 11, 19, 20, 21, 99}}, {"fiber_x", {0}}, {"fiber_y", {0}}});
+    auto num_adjacent = compare_with_reference(
+        "(sector_1 == sector_2) && ((abs(floor(module_1 / 10) - floor(module_2 / 10)) + abs(fmod(module_1, 10) - fmod(module_2, 10))) == 1)",
+        id_desc, cells,
+        [](const Cell& c1, const Cell& c2) {
+          double sector_1 = value(c1, "sector"), sector_2 = value(c2, "sector");
+          double module_1 = value(c1, "module"), module_2 = value(c2, "module");
+          return (sector_1 == sector_2) && ((abs(floor(module_1 / 10) - floor(module_2 / 10)) + abs(fmod(module_1, 10) - fmod(module_2, 10))) == 1);
+        });
+    CHECK(num_adjacent > 0);
+
+    AdjacencyMatrixExpression adjacency("(sector_1 == sector_2) && ((abs(floor(module_1 / 10) - floor(module_2 / 10)) + abs(fmod(module_1, 10) - fmod(module_2, 10))) == 1)", id_desc);
+    auto id = [&](int sector, int module) { return id_desc.encode({{"system", 1}, {"sector", sector}, {"module", module}}); };
+    CHECK(adjacency(id(0, 10), id(0, 11)));
+    CHECK(adjacency(id(0, 10), id(0, 20)));
+    CHECK_FALSE(adjacency(id(0, 9), id(0, 10)));  // different rows of the 10x10 grid
+    CHECK_FALSE(adjacency(id(0, 10), id(1, 11))); // different sectors
+    CHECK_FALSE(adjacency(id(0, 10), id(0, 10)));
+  }
+
+  SECTION( "BHCAL" ) {
+    // src/detectors/BHCAL/BHCAL.cc
+    const std::string expression =
+      "("
+      "  abs(fmod(tower_1, 24) - fmod(tower_2, 24))"
+      "  + min("
+      "      abs((sector_1 - sector_2) * (2 * 5) + (floor(tower_1 / 24) - floor(tower_2 / 24)) * 5 + fmod(tile_1, 5) - fmod(tile_2, 5)),"
+      "      (32 * 2 * 5) - abs((sector_1 - sector_2) * (2 * 5) + (floor(tower_1 / 24) - floor(tower_2 / 24)) * 5 + fmod(tile_1, 5) - fmod(tile_2, 5))"
+      "    )"
+      ") == 1";
+    dd4hep::IDDescriptor id_desc("HcalBarrelHits", "system:8,barrel:3,module:8,layer:8,slice:5,tower:8,sector:6,tile:8");
+    auto cells = all_cells({{"system", {1}}, {"sector", {0, 1, 31}}, {"tower", {0, 1, 23, 24, 25, 47}}, {"tile", {0, 1, 4, 5, 9}}});
+    auto num_adjacent = compare_with_reference(
+        expression, id_desc, cells,
+        [](const Cell& c1, const Cell& c2) {
+          double sector_1 = value(c1, "sector"), sector_2 = value(c2, "sector");
+          double tower_1 = value(c1, "tower"), tower_2 = value(c2, "tower");
+          double tile_1 = value(c1, "tile"), tile_2 = value(c2, "tile");
+          return (
+              abs(fmod(tower_1, 24) - fmod(tower_2, 24))
+              + min(
+                  abs((sector_1 - sector_2) * (2 * 5) + (floor(tower_1 / 24) - floor(tower_2 / 24)) * 5 + fmod(tile_1, 5) - fmod(tile_2, 5)),
+                  (32 * 2 * 5) - abs((sector_1 - sector_2) * (2 * 5) + (floor(tower_1 / 24) - floor(tower_2 / 24)) * 5 + fmod(tile_1, 5) - fmod(tile_2, 5))
+                )
+              ) == 1;
+        });
+    CHECK(num_adjacent > 0);
+
+    AdjacencyMatrixExpression adjacency(expression, id_desc);
+    auto id = [&](int sector, int tower, int tile) { return id_desc.encode({{"system", 1}, {"sector", sector}, {"tower", tower}, {"tile", tile}}); };
+    CHECK(adjacency(id(0, 0, 0), id(0, 1, 0)));
+    CHECK(adjacency(id(0, 0, 0), id(0, 0, 1)));
+    CHECK(adjacency(id(0, 0, 0), id(31, 24, 4)));       // wraps around in phi
+    CHECK_FALSE(adjacency(id(0, 0, 0), id(0, 1, 1)));
+    CHECK_FALSE(adjacency(id(0, 0, 0), id(31, 0, 0)));
+  }
+
+  SECTION( "FHCAL" ) {
+    // src/detectors/FHCAL/FHCAL.cc, LFHCAL
+    const std::string cellIdx_1 = "(54*2-moduleIDx_1*2+towerx_1)";
+    const std::string cellIdx_2 = "(54*2-moduleIDx_2*2+towerx_2)";
+    const std::string cellIdy_1 = "(54*2-moduleIDy_1*2+towery_1)";
+    const std::string cellIdy_2 = "(54*2-moduleIDy_2*2+towery_2)";
+    const std::string deltaX    = "abs(" + cellIdx_2 + "-" + cellIdx_1 + ")";
+    const std::string deltaY    = "abs(" + cellIdy_2 + "-" + cellIdy_1 + ")";
+    const std::string deltaZ    = "abs(rlayerz_2-rlayerz_1)";
+    const std::string neighbor  = "(" + deltaX + "+" + deltaY + "+" + deltaZ + "==1)";
+    const std::string corner2D  =
+      "((" + deltaZ + "==0&&" + deltaX + "==1&&" + deltaY + "==1)||"
+      "(" + deltaZ + "==1&&" + deltaX + "==0&&" + deltaY + "==1)||"
+      "(" + deltaZ + "==1&&" + deltaX + "==1&&" + deltaY + "==0))";
+    dd4hep::IDDescriptor id_desc("LFHCALHits", "system:8,moduleIDx:8,moduleIDy:8,moduletype:2,rlayerz:6,passive:1,layerz:6,towerx:2,towery:2");
+    auto cells = all_cells({{"system", {1}}, {"moduleIDx", {0, 1, 2}}, {"moduleIDy", {0, 1}}, {"towerx", {0, 1}}, {"towery", {0, 1}}, {"rlayerz", {0, 1, 2}}});
+    auto num_adjacent = compare_with_reference(
+        neighbor + "||" + corner2D, id_desc, cells,
+        [](const Cell& c1, const Cell& c2) {
+          double moduleIDx_1 = value(c1, "moduleIDx"), moduleIDx_2 = value(c2, "moduleIDx");
+          double moduleIDy_1 = value(c1, "moduleIDy"), moduleIDy_2 = value(c2, "moduleIDy");
+          double towerx_1 = value(c1, "towerx"), towerx_2 = value(c2, "towerx");
+          double towery_1 = value(c1, "towery"), towery_2 = value(c2, "towery");
+          double rlayerz_1 = value(c1, "rlayerz"), rlayerz_2 = value(c2, "rlayerz");
+          double deltaX = abs((54*2-moduleIDx_2*2+towerx_2)-(54*2-moduleIDx_1*2+towerx_1));
+          double deltaY = abs((54*2-moduleIDy_2*2+towery_2)-(54*2-moduleIDy_1*2+towery_1));
+          double deltaZ = abs(rlayerz_2-rlayerz_1);
+          return (deltaX+deltaY+deltaZ==1)
+            || ((deltaZ==0&&deltaX==1&&deltaY==1)||(deltaZ==1&&deltaX==0&&deltaY==1)||(deltaZ==1&&deltaX==1&&deltaY==0));
+        });
+    CHECK(num_adjacent > 0);
+  }
+}
@@ -16,6 +16,8 @@
 #include <spdlog/common.h>
 #include <spdlog/logger.h>
 #include <spdlog/spdlog.h>
+#include <cmath>
+#include <cstddef>
 #include <limits>
 #include <memory>
 #include <string>
@@ -225,3 +227,78 @@ TEST_CASE( "the clustering algorithm runs", "[CalorimeterIslandCluster]" ) {
     }
   }
 }
+
+TEST_CASE( "the neighbour index reproduces exhaustive grouping", "[CalorimeterIslandCluster]" ) {
+  CalorimeterIslandCluster algo;
+
+  std::shared_ptr<spdlog::logger> logger = spdlog::default_logger()->clone("CalorimeterIslandCluster");
+  logger->set_level(spdlog::level::info);
+
+  CalorimeterIslandClusterConfig cfg;
+  cfg.minClusterHitEdep = 0.1 * dd4hep::GeV;
+  cfg.minClusterCenterEdep = 0. * dd4hep::GeV;
+  cfg.sectorDist = 5.0 * dd4hep::cm;
+  cfg.splitCluster = false;
+
+  std::string method = GENERATE(as<std::string>{}, "localDistXY", "dimScaledLocalDistXY", "globalDistRPhi", "globalDistEtaPhi");
+  if (method == "localDistXY") {
+    cfg.localDistXY = {15 * dd4hep::mm, 15 * dd4hep::mm};
+  } else if (method == "dimScaledLocalDistXY") {
+    cfg.dimScaledLocalDistXY = {1.5, 1.5};
+  } else if (method == "globalDistRPhi") {
+    cfg.globalDistRPhi = {15 * dd4hep::mm, 0.05 * dd4hep::rad};
+  } else {
+    cfg.globalDistEtaPhi = {0.05, 0.05 * dd4hep::rad};
+  }
+
+  auto detector = dd4hep::Detector::make_unique("");
+  algo.applyConfig(cfg);
+  algo.init(detector.get(), logger);
+
+  // pseudo-random hits in two sectors, covering the phi = +-pi boundary
+  edm4eic::CalorimeterHitCollection hits_coll;
+  for (int i = 0; i < 400; ++i) {
+    float u = static_cast<float>((i * 37) % 101) / 101.f;
+    float v = static_cast<float>((i * 53) % 97) / 97.f;
+    float phi = static_cast<float>(M_PI) * (2.f * v - 1.f);
+    hits_coll.create(
+      0, // std::uint64_t cellID,
+      0.05f + static_cast<float>((i * 13) % 17) / 17.f, // float energy,
+      0.0, // float energyError,
+      0.0, // float time,
+      0.0, // float timeError,
+      edm4hep::Vector3f(1000.f * std::cos(phi), 1000.f * std::sin(phi), 400.f * u), // edm4hep::Vector3f position,
+      edm4hep::Vector3f(10.0, 10.0, 0.0), // edm4hep::Vector3f dimension,
+      i % 2, // std::int32_t sector,
+      0, // std::int32_t layer,
+      edm4hep::Vector3f(200.f * u, 200.f * v, 0.0) // edm4hep::Vector3f local
+    );
+  }
+  auto protoclust_coll = algo.process(hits_coll);
+
+  // group with an exhaustive search over all hit pairs
+  std::vector<bool> visits(hits_coll.size(), false);
+  std::vector<std::size_t> expected_sizes;
+  for (std::size_t i = 0; i < hits_coll.size(); ++i) {
+    if (visits[i] || hits_coll[i].getEnergy() < cfg.minClusterHitEdep) {
+      continue;
+    }
+    std::vector<std::size_t> group{i};
+    visits[i] = true;
+    for (std::size_t k = 0; k < group.size(); ++k) {
+      for (std::size_t j = 0; j < hits_coll.size(); ++j) {
+        if (!visits[j] && hits_coll[j].getEnergy() >= cfg.minClusterHitEdep
+            && algo.is_neighbour(hits_coll[group[k]], hits_coll[j])) {
+          visits[j] = true;
+          group.push_back(j);
+        }
+      }
+    }
+    expected_sizes.push_back(group.size());
+  }
+
+  REQUIRE( (*protoclust_coll).size() == expected_sizes.size() );
+  for (std::size_t i = 0; i < expected_sizes.size(); ++i) {
+    REQUIRE( (*protoclust_coll)[i].hits_size() == expected_sizes[i] );
+  }
+}
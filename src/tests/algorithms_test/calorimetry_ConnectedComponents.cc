@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "algorithms/calorimetry/ConnectedComponents.h"
+
+using eicrecon::ConnectedComponents;
+
+namespace {
+
+  struct Point {
+    double x;
+    double y;
+    double energy;
+  };
+
+  std::vector<Point> random_points(std::size_t n, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> position(0., 100.);
+    std::uniform_real_distribution<double> energy(0., 1.);
+    std::vector<Point> points;
+    for (std::size_t i = 0; i < n; ++i) {
+      points.push_back({position(rng), position(rng), energy(rng)});
+    }
+    return points;
+  }
+
+  // the breadth-first search grouping previously used by the clusterers
+  void bfs_group(const std::vector<Point>& points, double min_energy, double dist,
+                 std::set<std::size_t>& group, std::size_t idx, std::vector<bool>& visits) {
+    visits[idx] = true;
+    if (points[idx].energy < min_energy) {
+      return;
+    }
+    group.insert(idx);
+    std::size_t prev_size = 0;
+    while (prev_size != group.size()) {
+      prev_size = group.size();
+      for (std::size_t idx1 : group) {
+        for (std::size_t idx2 = 0; idx2 < points.size(); ++idx2) {
+          if (points[idx2].energy < min_energy) {
+            continue;
+          }
+          if (!visits[idx2]
+              && std::hypot(points[idx1].x - points[idx2].x, points[idx1].y - points[idx2].y) <= dist) {
+            group.insert(idx2);
+            visits[idx2] = true;
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<std::vector<std::size_t>> as_vectors(const ConnectedComponents& components) {
+    std::vector<std::vector<std::size_t>> groups;
+    for (std::size_t k = 0; k < components.size(); ++k) {
+      groups.emplace_back(components[k].begin(), components[k].end());
+    }
+    return groups;
+  }
+
+} // namespace
+
+TEST_CASE( "connected components reproduce the breadth-first search grouping", "[ConnectedComponents]" ) {
+  const std::size_t n = GENERATE(0, 1, 10, 200, 1000);
+  const double dist = GENERATE(0.5, 3., 10.);
+  const double min_energy = 0.2;
+  const double min_seed_energy = 0.7;
+  const auto points = random_points(n, 42);
+
+  auto included = [&](std::size_t i) { return !(points[i].energy < min_energy); };
+  auto neighbours = [&](std::size_t i, std::size_t j) {
+    return std::hypot(points[i].x - points[j].x, points[i].y - points[j].y) <= dist;
+  };
+  // candidates from a uniform grid with cells of size dist
+  auto cell = [&](std::size_t i) {
+    return std::make_pair(static_cast<long>(std::floor(points[i].x / dist)), static_cast<long>(std::floor(points[i].y / dist)));
+  };
+  auto candidates = [&](std::size_t i, auto&& visit) {
+    const auto [cx, cy] = cell(i);
+    for (std::size_t j = 0; j < points.size(); ++j) {
+      const auto [dx, dy] = cell(j);
+      if (std::abs(dx - cx) <= 1 && std::abs(dy - cy) <= 1) {
+        visit(j);
+      }
+    }
+  };
+
+  ConnectedComponents components;
+  const bool use_candidates = GENERATE(false, true);
+  if (use_candidates) {
+    components.compute(points.size(), included, candidates, neighbours);
+  } else {
+    components.compute(points.size(), included, neighbours);
+  }
+
+  SECTION( "starting from every hit" ) {
+    std::vector<std::vector<std::size_t>> expected;
+    std::vector<bool> visits(points.size(), false);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      if (visits[i]) {
+        continue;
+      }
+      std::set<std::size_t> group;
+      bfs_group(points, min_energy, dist, group, i, visits);
+      if (!group.empty()) {
+        expected.emplace_back(group.begin(), group.end());
+      }
+    }
+
+    components.collect();
+    REQUIRE( as_vectors(components) == expected );
+  }
+
+  SECTION( "starting from seed hits only" ) {
+    std::vector<std::vector<std::size_t>> expected;
+    std::vector<bool> visits(points.size(), false);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      if (visits[i] || points[i].energy < min_seed_energy) {
+        continue;
+      }
+      std::set<std::size_t> group;
+      bfs_group(points, min_energy, dist, group, i, visits);
+      expected.emplace_back(group.begin(), group.end());
+    }
+
+    components.collect([&](std::size_t i) { return !(points[i].energy < min_seed_energy); });
+    REQUIRE( as_vectors(components) == expected );
+  }
+}
+
+TEST_CASE( "connected components reuse storage between events", "[ConnectedComponents]" ) {
+  ConnectedComponents components;
+  auto all = [](std::size_t) { return true; };
+
+  // a chain 0 - 1 - 2 and an isolated hit 3
+  components.compute(4, all, [](std::size_t i, std::size_t j) { return j == i + 1 && j < 3; });
+  components.collect();
+  REQUIRE( components.size() == 2 );
+  REQUIRE( components[0].size() == 3 );
+  REQUIRE( components[1].size() == 1 );
+  REQUIRE( components[1][0] == 3 );
+
+  // fewer hits, all separate
+  components.compute(2, all, [](std::size_t, std::size_t) { return false; });
+  components.collect();
+  REQUIRE( components.size() == 2 );
+  REQUIRE( components[0][0] == 0 );
+  REQUIRE( components[1][0] == 1 );
+}
@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023, Christopher Dilks
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
+#include <edm4eic/RawTrackerHitCollection.h>
+#include <edm4hep/SimTrackerHitCollection.h>
+#include <edm4hep/Vector3d.h>
+#include <spdlog/common.h>
+#include <spdlog/logger.h>
+#include <spdlog/spdlog.h>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithms/digi/PhotoMultiplierHitDigi.h"
+#include "algorithms/digi/PhotoMultiplierHitDigiConfig.h"
+
+using eicrecon::PhotoMultiplierHitDigi;
+using eicrecon::PhotoMultiplierHitDigiConfig;
+
+TEST_CASE("the PhotoMultiplierHitDigi algorithm runs", "[PhotoMultiplierHitDigi]") {
+  PhotoMultiplierHitDigi algo;
+
+  std::shared_ptr<spdlog::logger> logger = spdlog::default_logger()->clone("PhotoMultiplierHitDigi");
+  logger->set_level(spdlog::level::info);
+
+  // no smearing, so that the charge is `pedMean + npe * speMean`
+  PhotoMultiplierHitDigiConfig cfg;
+  cfg.seed              = 5;
+  cfg.speMean           = 100.0;
+  cfg.speError          = 0.0;
+  cfg.pedMean           = 1000.0;
+  cfg.pedError          = 0.0;
+  cfg.quantumEfficiency = {{325, 1.00}, {900, 1.00}}; // unit QE
+
+  // number of photoelectrons of a raw hit
+  auto npe = [&cfg] (const auto& raw_hit) {
+    return static_cast<int>(std::lround((raw_hit.getCharge() - cfg.pedMean) / cfg.speMean));
+  };
+
+  SECTION("crosstalk probability must be in [0,1)") {
+    for(double prob : {-0.1, 1.0, 1.5}) {
+      cfg.crosstalkProbability = prob;
+      algo.applyConfig(cfg);
+      CHECK_THROWS_AS(algo.AlgorithmInit(nullptr, nullptr, logger), std::runtime_error);
+    }
+  }
+
+  SECTION("photon hits have the crosstalk multiplicity") {
+
+    // one photon, of energy 3 eV, in one pixel
+    edm4hep::SimTrackerHitCollection sim_hits;
+    auto sim_hit = sim_hits.create();
+    sim_hit.setCellID(0xABABABAB);
+    sim_hit.setEDep(3.0e-9); // [GeV]
+    sim_hit.setTime(10.0);   // [ns]
+    sim_hit.setPosition(edm4hep::Vector3d{0.0, 0.0, 0.0});
+
+    // npe of each event
+    auto sample_npe = [&] (std::size_t num_events) {
+      std::map<int,std::size_t> counts;
+      for(std::size_t i = 0; i < num_events; i++) {
+        auto result = algo.AlgorithmProcess(&sim_hits);
+        REQUIRE(result.raw_hits->size() == 1);
+        REQUIRE(result.hit_assocs->size() == 1);
+        REQUIRE((*result.raw_hits)[0].getCellID() == 0xABABABAB);
+        counts[npe((*result.raw_hits)[0])]++;
+      }
+      return counts;
+    };
+
+    SECTION("without crosstalk") {
+      cfg.crosstalkProbability = 0.0;
+      algo.applyConfig(cfg);
+      algo.AlgorithmInit(nullptr, nullptr, logger);
+      auto counts = sample_npe(100);
+      REQUIRE(counts.size() == 1);
+      CHECK(counts[1] == 100);
+    }
+
+    SECTION("with crosstalk") {
+      // npe is geometrically distributed: P(npe=k) = (1-p) p^(k-1)
+      const double p = 0.25;
+      const std::size_t num_events = 20000;
+      cfg.crosstalkProbability = p;
+      algo.applyConfig(cfg);
+      algo.AlgorithmInit(nullptr, nullptr, logger);
+      auto counts = sample_npe(num_events);
+      REQUIRE(counts.begin()->first == 1);
+      double mean = 0.0;
+      for(auto [n, count] : counts)
+        mean += n * static_cast<double>(count) / num_events;
+      // 5 sigma tolerances
+      CHECK_THAT(mean, Catch::Matchers::WithinAbs(1.0 / (1.0 - p), 5 * std::sqrt(p / num_events) / (1.0 - p)));
+      for(int k = 1; k <= 3; k++) {
+        double prob = (1.0 - p) * std::pow(p, k - 1);
+        CAPTURE(k);
+        CHECK_THAT(static_cast<double>(counts[k]) / num_events, Catch::Matchers::WithinAbs(prob, 5 * std::sqrt(prob * (1.0 - prob) / num_events)));
+      }
+    }
+  }
+
+  SECTION("noise hits are Poisson distributed over the noise pixels") {
+
+    // many pixels, so that noise hits rarely share a pixel
+    const std::size_t num_cells  = 50000;
+    const std::size_t num_events = 1000;
+    auto cellIDs = std::make_shared<std::vector<PhotoMultiplierHitDigi::CellIDType>>();
+    for(std::size_t i = 0; i < num_cells; i++)
+      cellIDs->push_back(0x1000000 + 2 * i);
+    const std::set<PhotoMultiplierHitDigi::CellIDType> cellID_set(cellIDs->begin(), cellIDs->end());
+
+    cfg.enableNoise     = true;
+    cfg.noiseRate       = 20000; // [Hz]
+    cfg.noiseTimeWindow = 20.0;  // [ns]
+    cfg.hitTimeWindow   = 0.0;   // do not merge noise hits which share a pixel
+    const double expected_mean = cfg.noiseRate * cfg.noiseTimeWindow * 1e-9 * num_cells; // = 20
+
+    auto run = [&] () {
+      algo.applyConfig(cfg);
+      algo.AlgorithmInit(nullptr, nullptr, logger);
+      algo.SetNoiseCellIDs(cellIDs);
+
+      edm4hep::SimTrackerHitCollection sim_hits;
+      std::vector<int> num_hits, total_npe;
+      for(std::size_t i = 0; i < num_events; i++) {
+        auto result = algo.AlgorithmProcess(&sim_hits);
+        CHECK(result.hit_assocs->size() == 0);
+        num_hits.push_back(result.raw_hits->size());
+        total_npe.push_back(0);
+        for(const auto& raw_hit : *result.raw_hits) {
+          CHECK(cellID_set.count(raw_hit.getCellID()) == 1);
+          CHECK(raw_hit.getTimeStamp() >= 0);
+          CHECK(raw_hit.getTimeStamp() <= cfg.noiseTimeWindow / cfg.timeResolution);
+          total_npe.back() += npe(raw_hit);
+        }
+      }
+      return std::make_pair(num_hits, total_npe);
+    };
+
+    auto mean_and_variance = [] (const std::vector<int>& values) {
+      double mean = 0.0, variance = 0.0;
+      for(auto v : values) mean += v;
+      mean /= values.size();
+      for(auto v : values) variance += (v - mean) * (v - mean);
+      variance /= values.size() - 1;
+      return std::make_pair(mean, variance);
+    };
+
+    SECTION("without crosstalk") {
+      cfg.crosstalkProbability = 0.0;
+      auto [num_hits, total_npe] = run();
+      auto [mean, variance] = mean_and_variance(num_hits);
+      CHECK_THAT(mean, Catch::Matchers::WithinAbs(expected_mean, 5 * std::sqrt(expected_mean / num_events)));
+      CHECK_THAT(variance, Catch::Matchers::WithinRel(expected_mean, 0.2));
+      CHECK(total_npe == num_hits);
+    }
+
+    SECTION("with crosstalk") {
+      // crosstalk does not change the number of noise hits, only their npe
+      const double p = 0.25;
+      cfg.crosstalkProbability = p;
+      auto [num_hits, total_npe] = run();
+      auto mean = mean_and_variance(num_hits).first;
+      CHECK_THAT(mean, Catch::Matchers::WithinAbs(expected_mean, 5 * std::sqrt(expected_mean / num_events)));
+      auto mean_npe = mean_and_variance(total_npe).first;
+      CHECK_THAT(mean_npe, Catch::Matchers::WithinRel(expected_mean / (1.0 - p), 0.05));
+    }
+  }
+}
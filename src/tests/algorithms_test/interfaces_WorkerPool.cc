@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "algorithms/interfaces/WorkerPool.h"
+
+using eicrecon::WorkerPool;
+
+TEST_CASE("the worker pool runs every task once", "[WorkerPool]") {
+  WorkerPool pool;
+  REQUIRE(pool.size() == 1);
+
+  for(std::size_t num_threads : {1, 2, 5}) {
+    pool.resize(num_threads);
+    REQUIRE(pool.size() == num_threads);
+    CAPTURE(num_threads);
+
+    // the same threads serve many calls, including calls with fewer tasks than threads
+    for(std::size_t num_tasks = 0; num_tasks < 50; num_tasks++) {
+      std::vector<std::size_t> runs(num_tasks, 0);
+      std::vector<std::size_t> threads(num_tasks, num_threads);
+      pool.run(num_tasks, [&] (std::size_t i_thread, std::size_t i_task) {
+        runs[i_task]++;
+        threads[i_task] = i_thread;
+      });
+      CAPTURE(num_tasks);
+      CHECK(runs == std::vector<std::size_t>(num_tasks, 1));
+      for(auto i_thread : threads)
+        CHECK(i_thread < num_threads);
+    }
+  }
+}
+
+TEST_CASE("the worker pool rethrows the exception of the first failing task", "[WorkerPool]") {
+  WorkerPool pool(4);
+  std::vector<int> runs(20, 0);
+  auto task = [&] (std::size_t, std::size_t i_task) {
+    runs[i_task]++;
+    if(i_task == 7 || i_task == 13)
+      throw std::runtime_error(std::to_string(i_task));
+  };
+  std::string what;
+  try {
+    pool.run(runs.size(), task);
+  }
+  catch(const std::runtime_error& e) {
+    what = e.what();
+  }
+  CHECK(what == "7");
+  // the other tasks have run, and the pool can be used again
+  CHECK(runs == std::vector<int>(20, 1));
+  pool.run(runs.size(), [&] (std::size_t, std::size_t i_task) { runs[i_task]++; });
+  CHECK(runs == std::vector<int>(20, 2));
+}
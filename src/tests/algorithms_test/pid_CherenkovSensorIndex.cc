@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023, Christopher Dilks
+
+#include <TVector3.h>
+#include <catch2/catch_test_macros.hpp>
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "algorithms/pid/CherenkovSensorIndex.h"
+
+using eicrecon::CherenkovSensorGeometry;
+using eicrecon::CherenkovSensorIndex;
+
+namespace {
+
+  // unit vector with polar angle `theta` and azimuth `phi`
+  TVector3 unit(double theta, double phi) {
+    TVector3 v(0, 0, 1);
+    v.SetMagThetaPhi(1.0, theta, phi);
+    return v;
+  }
+
+  // all sensors reached by a cone, checking every sensor, as `FindReachableSensors` should
+  std::vector<uint64_t> reachable(const CherenkovSensorGeometry& geometry, const TVector3& direction, double max_angle) {
+    std::vector<uint64_t> ids;
+    auto dir = direction.Unit();
+    for(const auto& [id, sensor] : geometry.sensors) {
+      auto mirror_it = geometry.mirror_centers.find(sensor.sector);
+      if(mirror_it == geometry.mirror_centers.end())
+        continue;
+      auto to_sensor  = sensor.position - mirror_it->second;
+      auto half_angle = std::atan(sensor.size / std::sqrt(2.0) / to_sensor.Mag());
+      if(dir.Dot(to_sensor.Unit()) >= std::cos(std::min(M_PI, max_angle + half_angle)))
+        ids.push_back(id);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  std::vector<uint64_t> find(const CherenkovSensorIndex& index, const TVector3& direction, double max_angle) {
+    std::vector<uint64_t> ids;
+    index.FindReachableSensors(direction, max_angle, ids);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+} // namespace
+
+TEST_CASE("the Cherenkov sensor index finds the sensors inside the cone", "[CherenkovSensorIndex]") {
+
+  // Synthetic layout: sector 0 has its mirror center at the origin, and sensors on a sphere of
+  // radius 1 m in every direction, with rings close to both poles and sensors at phi = +-pi;
+  // sector 1 has its mirror center displaced, and sensors in a patch; sector 2 has no mirror.
+  CherenkovSensorGeometry geometry;
+  geometry.mirror_centers[0] = TVector3(0, 0, 0);
+  geometry.mirror_centers[1] = TVector3(50, -30, 200);
+  uint64_t id = 1;
+  const double radius = 1000.0;
+  const double size   = 3.0;
+  auto add_sensor = [&] (int sector, double theta, double phi) {
+    auto center = geometry.mirror_centers.count(sector) ? geometry.mirror_centers[sector] : TVector3(0, 0, 0);
+    geometry.sensors[id++] = { sector, center + radius * unit(theta, phi), size };
+  };
+  for(int i = 0; i <= 60; i++) {
+    const double theta = M_PI * i / 60;
+    const int num_phi  = std::max(1, static_cast<int>(std::round(120 * std::sin(theta))));
+    for(int j = 0; j < num_phi; j++)
+      add_sensor(0, theta, -M_PI + 2 * M_PI * j / num_phi);
+  }
+  for(double theta : {1e-4, 2e-3, M_PI - 1e-4, M_PI - 2e-3})
+    for(double phi : {-M_PI, -M_PI + 1e-9, -1.0, 0.0, 2.0, M_PI - 1e-9})
+      add_sensor(0, theta, phi);
+  for(double theta : {0.3, 1.2, 2.5})
+    for(double phi : {-M_PI, M_PI - 1e-12, M_PI - 1e-3, -M_PI + 1e-3})
+      add_sensor(0, theta, phi);
+  for(int i = 0; i < 20; i++)
+    for(int j = 0; j < 20; j++)
+      add_sensor(1, 0.4 + 0.01 * i, 2.8 + 0.03 * j);
+  add_sensor(2, 1.0, 0.0);
+
+  CherenkovSensorIndex index;
+  REQUIRE(index.Build(geometry) == geometry.sensors.size() - 1);
+  REQUIRE(index.Enabled());
+
+  auto check = [&] (const TVector3& direction, double max_angle) {
+    CAPTURE(direction.Theta(), direction.Phi(), max_angle);
+    CHECK(find(index, direction, max_angle) == reachable(geometry, direction, max_angle));
+  };
+
+  SECTION("cones across phi = +-pi") {
+    for(double theta : {0.05, 0.5, 1.2, M_PI / 2, 2.5, M_PI - 0.05})
+      for(double phi : {-M_PI, -M_PI + 1e-6, M_PI - 1e-6, M_PI - 0.02, -M_PI + 0.02})
+        for(double max_angle : {0.0, 0.01, 0.05, 0.3})
+          check(unit(theta, phi), max_angle);
+  }
+
+  SECTION("cones near and around the poles") {
+    for(double theta : {0.0, 1e-6, 1e-3, 0.02, 0.06, M_PI - 0.06, M_PI - 0.02, M_PI - 1e-3, M_PI})
+      for(double phi : {-M_PI, -2.0, 0.0, 1.0, M_PI})
+        for(double max_angle : {0.0, 0.005, 0.05, 0.2})
+          check(unit(theta, phi), max_angle);
+  }
+
+  SECTION("random cones") {
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<double> uni(0.0, 1.0);
+    for(int n = 0; n < 2000; n++) {
+      auto direction = unit(std::acos(2 * uni(gen) - 1), M_PI * (2 * uni(gen) - 1));
+      check(direction * (0.5 + 10 * uni(gen)), 0.5 * uni(gen) * uni(gen));
+    }
+  }
+
+  SECTION("large cones reach the whole sphere") {
+    check(unit(0.3, 1.0), M_PI / 2);
+    check(unit(2.0, -3.0), 3.0);
+    check(unit(2.0, -3.0), 10.0);
+  }
+
+  SECTION("no sensors for a null direction") {
+    CHECK(find(index, TVector3(0, 0, 0), 0.1).empty());
+  }
+}
+
+TEST_CASE("the Cherenkov sensor index is disabled without focusing mirrors", "[CherenkovSensorIndex]") {
+  CherenkovSensorGeometry geometry;
+  geometry.sensors[1] = { 3, TVector3(0, 0, 1000), 3.0 };
+  CherenkovSensorIndex index;
+  CHECK(index.Build(geometry) == 0);
+  CHECK_FALSE(index.Enabled());
+  CHECK(find(index, TVector3(0, 0, 1), 0.1).empty());
+}
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Wouter Deconinck
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+#include <spdlog/logger.h>
+#include <spdlog/spdlog.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "algorithms/tracking/AmbiguitySolver.h"
+#include "algorithms/tracking/AmbiguitySolverConfig.h"
+
+using eicrecon::AmbiguitySolver;
+using eicrecon::AmbiguitySolverConfig;
+
+TEST_CASE("the ambiguity solver selects tracks", "[AmbiguitySolver]") {
+  AmbiguitySolver algo;
+
+  std::shared_ptr<spdlog::logger> logger = spdlog::default_logger()->clone("AmbiguitySolver");
+  logger->set_level(spdlog::level::trace);
+  algo.init(logger);
+
+  AmbiguitySolverConfig cfg;
+  cfg.m_maxSharedHits   = 1;
+  cfg.m_minMeasurements = 3;
+
+  using Selection = std::vector<bool>;
+  const double inf = std::numeric_limits<double>::infinity();
+
+  SECTION("tracks without shared measurements are kept") {
+    algo.applyConfig(cfg);
+    CHECK(algo.select({{1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10}}, {1.0, 20.0, 0.5}) == Selection{true, true, true});
+    CHECK(algo.select({}, {}).empty());
+  }
+
+  SECTION("quality criteria") {
+    cfg.m_maxChi2Ndf = 10.0;
+    algo.applyConfig(cfg);
+
+    // too few measurements, too large chi2/ndf, exactly at the limits
+    CHECK(algo.select({{1, 2}, {3, 4, 5}, {6, 7, 8}}, {1.0, 10.5, 10.0}) == Selection{false, false, true});
+
+    // tracks without degrees of freedom, which have no finite chi2/ndf, even without a chi2/ndf limit
+    cfg.m_maxChi2Ndf = inf;
+    algo.applyConfig(cfg);
+    CHECK(algo.select({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, {inf, std::nan(""), 1e30}) == Selection{false, false, true});
+  }
+
+  SECTION("shared measurements") {
+    algo.applyConfig(cfg);
+
+    // sharing up to m_maxSharedHits measurements is allowed
+    CHECK(algo.select({{1, 2, 3}, {3, 4, 5}}, {1.0, 2.0}) == Selection{true, true});
+
+    // the track with the larger fraction of shared measurements is removed, whatever its chi2/ndf
+    CHECK(algo.select({{1, 2, 3, 4}, {1, 2, 5, 6, 7, 8}}, {1.0, 5.0}) == Selection{false, true});
+    CHECK(algo.select({{1, 2, 5, 6, 7, 8}, {1, 2, 3, 4}}, {5.0, 1.0}) == Selection{true, false});
+
+    // the same fraction: the track with the larger chi2/ndf is removed, in either order
+    CHECK(algo.select({{1, 2, 3, 4}, {1, 2, 5, 6}}, {3.0, 2.0}) == Selection{false, true});
+    CHECK(algo.select({{1, 2, 5, 6}, {1, 2, 3, 4}}, {2.0, 3.0}) == Selection{true, false});
+
+    // a full tie: the first track is removed
+    CHECK(algo.select({{1, 2, 3}, {1, 2, 3}}, {2.0, 2.0}) == Selection{false, true});
+
+    // the partners of a removed track no longer share with it, and are kept
+    CHECK(algo.select({{1, 2, 3, 4}, {1, 2, 5, 6, 7}, {3, 4, 8, 9, 10}}, {1.0, 1.0, 1.0}) == Selection{false, true, true});
+
+    // sharing with a track that fails the quality criteria does not count
+    CHECK(algo.select({{1, 2}, {1, 2, 3}}, {1.0, 1.0}) == Selection{false, true});
+    CHECK(algo.select({{1, 2, 3}, {1, 2, 3}}, {inf, 1.0}) == Selection{false, true});
+
+    // duplicates are removed one at a time, until no track shares too many measurements
+    CHECK(algo.select({{1, 2, 3}, {1, 2, 3}, {1, 2, 3}, {1, 2, 3, 4}}, {1.0, 2.0, 3.0, 4.0}) == Selection{false, false, false, true});
+  }
+
+  SECTION("the number of removed tracks is limited") {
+    cfg.m_maxIterations = 1;
+    algo.applyConfig(cfg);
+    CHECK(algo.select({{1, 2, 3}, {1, 2, 3}, {1, 2, 3}}, {1.0, 2.0, 3.0}) == Selection{true, true, false});
+
+    cfg.m_maxIterations = 0;
+    algo.applyConfig(cfg);
+    CHECK(algo.select({{1, 2, 3}, {1, 2, 3}}, {1.0, 2.0}) == Selection{true, true});
+  }
+}
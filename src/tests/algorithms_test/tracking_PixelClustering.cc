@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Shujie Li
+
+#include <Acts/Definitions/Algebra.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "algorithms/tracking/PixelClustering.h"
+#include "algorithms/tracking/TrackerMeasurementFromHitsConfig.h"
+
+using eicrecon::PixelCluster;
+using eicrecon::PixelClustering;
+using eicrecon::PixelHit;
+using Catch::Matchers::WithinAbs;
+using Catch::Matchers::WithinRel;
+
+namespace {
+
+  constexpr double pitch0 = 0.02; // [mm]
+  constexpr double pitch1 = 0.05; // [mm]
+
+  // hit in pixel (i,j) of sensor `vol_id`
+  PixelHit pixel(std::uint64_t vol_id, int i, int j, double edep = 1.0, double time = 0.0, double time_error = 1.0) {
+    Acts::SymMatrix2 cov = Acts::SymMatrix2::Zero();
+    cov(0, 0) = pitch0 * pitch0 / 12;
+    cov(1, 1) = pitch1 * pitch1 / 12;
+    return {vol_id, Acts::Vector2(1.0 + i * pitch0, -2.0 + j * pitch1), cov, edep, time, time_error};
+  }
+
+} // namespace
+
+TEST_CASE("hits in pixels sharing an edge or a corner are adjacent", "[PixelClustering]") {
+  const auto h = pixel(1, 10, 10);
+  CHECK(PixelClustering::adjacent(h, pixel(1, 11, 10)));
+  CHECK(PixelClustering::adjacent(h, pixel(1, 9, 10)));
+  CHECK(PixelClustering::adjacent(h, pixel(1, 10, 11)));
+  CHECK(PixelClustering::adjacent(h, pixel(1, 10, 9)));
+  CHECK(PixelClustering::adjacent(h, pixel(1, 11, 11)));
+  CHECK(PixelClustering::adjacent(h, pixel(1, 9, 11)));
+  CHECK(PixelClustering::adjacent(h, pixel(1, 11, 9)));
+  CHECK_FALSE(PixelClustering::adjacent(h, pixel(1, 12, 10)));
+  CHECK_FALSE(PixelClustering::adjacent(h, pixel(1, 10, 12)));
+  CHECK_FALSE(PixelClustering::adjacent(h, pixel(1, 8, 8)));
+  // the pitch differs between the axes: one pitch in loc1 is more than 1.5 pitches in loc0
+  auto shifted = h;
+  shifted.loc[0] += pitch1;
+  CHECK_FALSE(PixelClustering::adjacent(h, shifted));
+}
+
+TEST_CASE("hits are clustered", "[PixelClustering]") {
+  PixelClustering algo;
+  eicrecon::TrackerMeasurementFromHitsConfig cfg;
+  cfg.m_clustering = true;
+  std::vector<PixelCluster> clusters;
+
+  // a chain (0, 4, 2) whose ends are not adjacent, a single hit (1),
+  // and a hit (3) at the position of the chain, but on another sensor
+  const std::vector<PixelHit> hits = {
+    pixel(1, 10, 10),
+    pixel(1, 20, 10),
+    pixel(1, 12, 11),
+    pixel(2, 10, 10),
+    pixel(1, 11, 11),
+  };
+
+  SECTION("adjacent hits of a sensor form one cluster") {
+    algo.applyConfig(cfg);
+    algo.cluster(hits, clusters);
+    REQUIRE(clusters.size() == 3);
+    // ordered by the first hit, hits in input order
+    CHECK(clusters[0].hits == std::vector<std::size_t>{0, 2, 4});
+    CHECK(clusters[1].hits == std::vector<std::size_t>{1});
+    CHECK(clusters[2].hits == std::vector<std::size_t>{3});
+  }
+
+  SECTION("without clustering every hit is a measurement") {
+    // off by default
+    cfg = eicrecon::TrackerMeasurementFromHitsConfig{};
+    CHECK_FALSE(cfg.m_clustering);
+    algo.applyConfig(cfg);
+    algo.cluster(hits, clusters);
+    REQUIRE(clusters.size() == hits.size());
+    for (std::size_t i = 0; i < hits.size(); ++i) {
+      CHECK(clusters[i].hits == std::vector<std::size_t>{i});
+      CHECK(clusters[i].loc == hits[i].loc);
+      CHECK(clusters[i].cov == hits[i].cov);
+    }
+  }
+
+  SECTION("hits not flagged for clustering are kept separately") {
+    auto flagged = hits;
+    flagged[4].clustering = false;
+    algo.applyConfig(cfg);
+    algo.cluster(flagged, clusters);
+    REQUIRE(clusters.size() == 5);
+    CHECK(clusters[0].hits == std::vector<std::size_t>{0});
+    CHECK(clusters[1].hits == std::vector<std::size_t>{1});
+    CHECK(clusters[2].hits == std::vector<std::size_t>{2});
+    CHECK(clusters[3].hits == std::vector<std::size_t>{3});
+    CHECK(clusters[4].hits == std::vector<std::size_t>{4});
+  }
+
+  SECTION("clusters below the minimum size are dropped") {
+    cfg.m_minClusterSize = 2;
+    algo.applyConfig(cfg);
+    algo.cluster(hits, clusters);
+    REQUIRE(clusters.size() == 1);
+    CHECK(clusters[0].hits == std::vector<std::size_t>{0, 2, 4});
+  }
+
+  SECTION("hits of clusters above the maximum size are kept separately") {
+    cfg.m_maxClusterSize = 2;
+    algo.applyConfig(cfg);
+    algo.cluster(hits, clusters);
+    REQUIRE(clusters.size() == 5);
+    CHECK(clusters[0].hits == std::vector<std::size_t>{0});
+    CHECK(clusters[1].hits == std::vector<std::size_t>{2});
+    CHECK(clusters[2].hits == std::vector<std::size_t>{4});
+    CHECK(clusters[3].hits == std::vector<std::size_t>{1});
+    CHECK(clusters[4].hits == std::vector<std::size_t>{3});
+    CHECK(clusters[1].loc == hits[2].loc);
+    CHECK(clusters[1].weights == std::vector<double>{1.0});
+  }
+
+  SECTION("the scratch space is reused between events") {
+    algo.applyConfig(cfg);
+    algo.cluster(hits, clusters);
+    algo.cluster({hits[1]}, clusters);
+    REQUIRE(clusters.size() == 1);
+    CHECK(clusters[0].hits == std::vector<std::size_t>{0});
+  }
+}
+
+TEST_CASE("cluster positions are charge weighted", "[PixelClustering]") {
+  PixelClustering algo;
+  eicrecon::TrackerMeasurementFromHitsConfig cfg;
+  cfg.m_clustering = true;
+  algo.applyConfig(cfg);
+  std::vector<PixelCluster> clusters;
+
+  SECTION("with deposited energy") {
+    const std::vector<PixelHit> hits = {
+      pixel(1, 10, 10, 1.0, 4.0, 0.3),
+      pixel(1, 11, 10, 3.0, 8.0, 0.4),
+    };
+    algo.cluster(hits, clusters);
+    REQUIRE(clusters.size() == 1);
+    const auto& c = clusters[0];
+    REQUIRE(c.weights.size() == 2);
+    CHECK_THAT(c.weights[0], WithinRel(0.25, 1e-12));
+    CHECK_THAT(c.weights[1], WithinRel(0.75, 1e-12));
+    CHECK_THAT(c.loc[0], WithinAbs(hits[0].loc[0] + 0.75 * pitch0, 1e-12));
+    CHECK_THAT(c.loc[1], WithinAbs(hits[0].loc[1], 1e-12));
+    CHECK_THAT(c.time, WithinAbs(7.0, 1e-12));
+    // independent time measurements
+    CHECK_THAT(c.time_error, WithinRel(std::hypot(0.25 * 0.3, 0.75 * 0.4), 1e-12));
+  }
+
+  SECTION("without deposited energy, hits count equally") {
+    const std::vector<PixelHit> hits = {
+      pixel(1, 10, 10, 0.0),
+      pixel(1, 11, 10, 0.0),
+      pixel(1, 11, 11, 0.0),
+      pixel(1, 12, 12, -1.0),
+    };
+    algo.cluster(hits, clusters);
+    REQUIRE(clusters.size() == 1);
+    const auto& c = clusters[0];
+    for (auto w : c.weights) {
+      CHECK_THAT(w, WithinRel(0.25, 1e-12));
+    }
+    CHECK_THAT(c.loc[0], WithinAbs(hits[0].loc[0] + 1.0 * pitch0, 1e-12));
+    CHECK_THAT(c.loc[1], WithinAbs(hits[0].loc[1] + 0.75 * pitch1, 1e-12));
+  }
+
+  SECTION("the position error does not shrink with the number of hits") {
+    for (int n = 1; n <= 5; ++n) {
+      std::vector<PixelHit> hits;
+      for (int i = 0; i < n; ++i) {
+        hits.push_back(pixel(1, 10 + i, 10, 1.0 + i));
+      }
+      algo.cluster(hits, clusters);
+      REQUIRE(clusters.size() == 1);
+      CAPTURE(n);
+      CHECK_THAT(clusters[0].cov(0, 0), WithinRel(pitch0 * pitch0 / 12, 1e-12));
+      CHECK_THAT(clusters[0].cov(1, 1), WithinRel(pitch1 * pitch1 / 12, 1e-12));
+      CHECK(clusters[0].cov(0, 1) == 0);
+    }
+  }
+}
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023, Dmitry Romanov
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "algorithms/tracking/SeedBatch.h"
+
+using eicrecon::SeedBatch;
+using Catch::Matchers::WithinAbs;
+using Catch::Matchers::WithinRel;
+
+namespace {
+
+  struct Point { double x, y; };
+  using Triplet = std::array<Point, SeedBatch::kHits>;
+
+  // Taubin circle fit of a single seed, as it was before the fit was batched
+  std::tuple<double,double,double> reference_circle_fit(const Triplet& positions) {
+    double meanX = 0, meanY = 0, weight = 0;
+    for (const auto& [x,y] : positions) {
+      meanX += x;
+      meanY += y;
+      ++weight;
+    }
+    meanX /= weight;
+    meanY /= weight;
+
+    double Mxx = 0, Myy = 0, Mxy = 0, Mxz = 0, Myz = 0, Mzz = 0;
+    for (const auto& [x,y] : positions) {
+      double Xi = x - meanX;
+      double Yi = y - meanY;
+      double Zi = Xi*Xi + Yi*Yi;
+      Mxy += Xi*Yi;
+      Mxx += Xi*Xi;
+      Myy += Yi*Yi;
+      Mxz += Xi*Zi;
+      Myz += Yi*Zi;
+      Mzz += Zi*Zi;
+    }
+    Mxx /= weight;
+    Myy /= weight;
+    Mxy /= weight;
+    Mxz /= weight;
+    Myz /= weight;
+    Mzz /= weight;
+
+    const double Mz = Mxx + Myy;
+    const double Cov_xy = Mxx*Myy - Mxy*Mxy;
+    const double Var_z = Mzz - Mz*Mz;
+    const double A3 = 4*Mz;
+    const double A2 = -3*Mz*Mz - Mzz;
+    const double A1 = Var_z*Mz + 4*Cov_xy*Mz - Mxz*Mxz - Myz*Myz;
+    const double A0 = Mxz*(Mxz*Myy - Myz*Mxy) + Myz*(Myz*Mxx - Mxz*Mxy) - Var_z*Cov_xy;
+
+    double x = 0;
+    double y = A0;
+    for (int iter = 0; iter < 99; ++iter) {
+      const double Dy = A1 + x*(2*A2 + 3*A3*x);
+      const double xnew = x - y/Dy;
+      if ((xnew == x) || (!std::isfinite(xnew))) break;
+      const double ynew = A0 + xnew*(A1 + xnew*(A2 + xnew*A3));
+      if (std::abs(ynew) >= std::abs(y)) break;
+      x = xnew;
+      y = ynew;
+    }
+
+    const double DET = x*x - x*Mz + Cov_xy;
+    const double Xcenter = (Mxz*(Myy - x) - Myz*Mxy)/DET/2;
+    const double Ycenter = (Myz*(Mxx - x) - Mxz*Mxy)/DET/2;
+    return {std::sqrt(Xcenter*Xcenter + Ycenter*Ycenter + Mz), Xcenter + meanX, Ycenter + meanY};
+  }
+
+  // three hits on the circle of radius R around (X0,Y0), at angles phi0, phi0 + dphi and phi0 + 2.3 dphi
+  Triplet on_circle(double R, double X0, double Y0, double phi0, double dphi) {
+    Triplet t;
+    const double phis[] = {phi0, phi0 + dphi, phi0 + 2.3 * dphi};
+    for (std::size_t k = 0; k < SeedBatch::kHits; ++k) {
+      t[k] = {X0 + R * std::cos(phis[k]), Y0 + R * std::sin(phis[k])};
+    }
+    return t;
+  }
+
+  void fill(SeedBatch& b, const std::vector<Triplet>& triplets) {
+    b.resize(triplets.size());
+    for (std::size_t i = 0; i < triplets.size(); ++i) {
+      for (std::size_t k = 0; k < SeedBatch::kHits; ++k) {
+        b.x[k][i] = triplets[i][k].x;
+        b.y[k][i] = triplets[i][k].y;
+        b.r[k][i] = std::hypot(b.x[k][i], b.y[k][i]);
+        b.z[k][i] = 0;
+      }
+      b.hitVariance[i] = 0;
+    }
+  }
+
+} // namespace
+
+TEST_CASE("the batched seed circle fit matches the fit of single seeds", "[SeedBatch]") {
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> uni(0., 1.);
+
+  std::vector<Triplet> triplets;
+  std::vector<std::array<double,3>> truth; // R, X0, Y0
+
+  // tracks from near the origin, from low pT to almost straight
+  for (double R : {100., 500., 3000., 2.e4, 1.e5, 1.e6}) {
+    for (int n = 0; n < 7; ++n) {
+      const double phi = 2 * M_PI * uni(gen);
+      const double X0 = (R + 0.5 * uni(gen)) * std::cos(phi);
+      const double Y0 = (R + 0.5 * uni(gen)) * std::sin(phi);
+      const double phi0 = phi + M_PI + 1e-4 * uni(gen);
+      const double dphi = (uni(gen) < 0.5 ? 1 : -1) * std::min(0.5, 150. / R);
+      triplets.push_back(on_circle(R, X0, Y0, phi0, dphi));
+      truth.push_back({R, X0, Y0});
+    }
+  }
+  const std::size_t num_regular = triplets.size();
+
+  // nearly collinear and collinear hits, mixed into the same blocks as the regular seeds
+  triplets.push_back(on_circle(1.e8, 1.e8, 0., M_PI, 3.e-6));
+  triplets.push_back({{{10., 20.}, {30., 60.}, {50., 100.}}});
+  triplets.push_back({{{10., 0.}, {80., 0.}, {200., 1.e-9}}});
+  triplets.push_back({{{10., 10.}, {10., 10.}, {10., 10.}}});
+
+  SeedBatch b;
+  fill(b, triplets);
+  REQUIRE(b.size % SeedBatch::kBlock != 0); // one block is not full
+  b.fitCircles();
+
+  SECTION("the fit reproduces the circle through three hits") {
+    for (std::size_t i = 0; i < num_regular; ++i) {
+      CAPTURE(i, truth[i][0]);
+      CHECK_THAT(b.R[i], WithinRel(truth[i][0], 1e-6));
+      CHECK_THAT(b.X0[i], WithinAbs(truth[i][1], 1e-6 * truth[i][0]));
+      CHECK_THAT(b.Y0[i], WithinAbs(truth[i][2], 1e-6 * truth[i][0]));
+    }
+  }
+
+  SECTION("every seed, including (nearly) collinear ones, is fitted as on its own") {
+    for (std::size_t i = 0; i < triplets.size(); ++i) {
+      CAPTURE(i);
+      auto [R, X0, Y0] = reference_circle_fit(triplets[i]);
+      REQUIRE(std::isfinite(b.R[i]) == std::isfinite(R));
+      REQUIRE(std::isfinite(b.X0[i]) == std::isfinite(X0));
+      REQUIRE(std::isfinite(b.Y0[i]) == std::isfinite(Y0));
+      if (std::isfinite(R)) {
+        CHECK_THAT(b.R[i], WithinRel(R, 1e-12));
+      }
+      if (std::isfinite(X0) && std::isfinite(Y0)) {
+        CHECK_THAT(b.X0[i], WithinAbs(X0, 1e-12 * std::hypot(X0, Y0)));
+        CHECK_THAT(b.Y0[i], WithinAbs(Y0, 1e-12 * std::hypot(X0, Y0)));
+      }
+    }
+  }
+
+  SECTION("the result of a seed does not depend on the rest of its block") {
+    for (std::size_t i = 0; i < triplets.size(); ++i) {
+      CAPTURE(i);
+      SeedBatch single;
+      fill(single, {triplets[i]});
+      single.fitCircles();
+      if (std::isfinite(b.R[i])) {
+        CHECK(single.R[0] == b.R[i]);
+        CHECK(single.X0[0] == b.X0[i]);
+        CHECK(single.Y0[0] == b.Y0[i]);
+      } else {
+        CHECK_FALSE(std::isfinite(single.R[0]));
+      }
+    }
+  }
+}
+
+TEST_CASE("the batched seed line fit matches least squares", "[SeedBatch]") {
+
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> uni(0., 1.);
+  std::normal_distribution<double> norm(0., 1.);
+
+  const std::size_t num_seeds = 2 * SeedBatch::kBlock + 3;
+  SeedBatch b;
+  b.resize(num_seeds);
+  for (std::size_t i = 0; i < num_seeds; ++i) {
+    const double slope = 4 * (uni(gen) - 0.5);
+    const double intercept = 100 * (uni(gen) - 0.5);
+    const double rs[] = {30 + 10 * uni(gen), 70 + 10 * uni(gen), 300 + 100 * uni(gen)};
+    // half of the seeds exactly on the line
+    const double scatter = i % 2 == 0 ? 0. : 0.5;
+    for (std::size_t k = 0; k < SeedBatch::kHits; ++k) {
+      b.r[k][i] = rs[k];
+      b.z[k][i] = slope * rs[k] + intercept + scatter * norm(gen);
+    }
+    b.hitVariance[i] = 0.01;
+  }
+  b.fitLines();
+
+  for (std::size_t i = 0; i < num_seeds; ++i) {
+    CAPTURE(i);
+
+    // least squares z = A (slope, intercept)
+    Eigen::Matrix<double, SeedBatch::kHits, 2> A;
+    Eigen::Matrix<double, SeedBatch::kHits, 1> z;
+    for (std::size_t k = 0; k < SeedBatch::kHits; ++k) {
+      A(k, 0) = b.r[k][i];
+      A(k, 1) = 1;
+      z(k) = b.z[k][i];
+    }
+    const Eigen::Vector2d params = A.colPivHouseholderQr().solve(z);
+    const double chi2 = (A * params - z).squaredNorm();
+    const double sigma2 = std::max(chi2 / (SeedBatch::kHits - 2), b.hitVariance[i]);
+    const Eigen::Matrix2d cov = sigma2 * (A.transpose() * A).inverse();
+
+    CHECK_THAT(b.slope[i], WithinAbs(params(0), 1e-9));
+    CHECK_THAT(b.intercept[i], WithinAbs(params(1), 1e-7));
+    CHECK_THAT(b.varSlope[i], WithinRel(cov(0, 0), 1e-6));
+    CHECK_THAT(b.varIntercept[i], WithinRel(cov(1, 1), 1e-6));
+    CHECK_THAT(b.covSlopeIntercept[i], WithinRel(cov(0, 1), 1e-6));
+  }
+}